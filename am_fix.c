@@ -479,7 +479,12 @@
 			{
 				const unsigned int index = gain_table_index[vfo];
 //				sprintf(s, "%2u.%u %4ddB %3u", index, ARRAY_SIZE(gain_table) - 1, gain_table[index].gain_dB, prev_rssi[vfo]);
-				sprintf(s, "%2u %4ddB %3u", index, gain_table[index].gain_dB, prev_rssi[vfo]);
+//				sprintf(s, "%2u %4ddB %3u", index, gain_table[index].gain_dB, prev_rssi[vfo]);
+				s = NUMBER_UnsignedToString(s, index, 2, ' ');
+				*s++ = ' ';
+				s = NUMBER_SignedToString(s, gain_table[index].gain_dB, 4);
+				strcpy(s, "dB ");
+				NUMBER_UnsignedToString(s + 3, prev_rssi[vfo], 3, ' ');
 				counter = 0;
 			}
 		}
@@ -139,25 +139,21 @@ void ACTION_Scan(bool bRestart)
 				}
 				else
 				{
-					uint16_t Frequency;
-
 					if (bRestart)
-					{
+					{	// hardware seek through the whole band, strongest stations kept
 						g_fm_auto_scan        = true;
 						g_fm_channel_position = 0;
 						FM_EraseChannels();
-						Frequency           = g_eeprom.fm_lower_limit;
+						FM_StartAutoScan();
 					}
 					else
 					{
 						g_fm_auto_scan        = false;
 						g_fm_channel_position = 0;
-						Frequency           = g_eeprom.fm_frequency_playing;
+						BK1080_GetFrequencyDeviation(g_eeprom.fm_frequency_playing);
+						FM_Tune(g_eeprom.fm_frequency_playing, 1, false);
 					}
 
-					BK1080_GetFrequencyDeviation(Frequency);
-					FM_Tune(Frequency, 1, bRestart);
-
 					#ifdef ENABLE_VOICE
 						g_another_voice_id = VOICE_ID_SCANNING_BEGIN;
 					#endif
@@ -0,0 +1,171 @@
+/* Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#include "app/activity.h"
+#include "functions.h"
+#include "radio.h"
+
+activity_t     g_activity[USER_CHANNEL_LAST + 1];
+uint16_t       g_activity_tick_500ms = 1;
+
+static uint8_t hot_channel[ACTIVITY_HOT_NUM];
+static uint8_t hot_count;
+static uint8_t hot_index;
+static uint8_t resume_channel = 0xFF;
+
+void ACTIVITY_Heard(const uint8_t Channel)
+{	// squelch has just opened on a memory channel
+	activity_t *pAct;
+
+	if (!IS_USER_CHANNEL(Channel))
+		return;
+
+	pAct = &g_activity[Channel];
+	if (pAct->hits < 255)
+		pAct->hits++;
+	pAct->last_heard = g_activity_tick_500ms;
+}
+
+void ACTIVITY_TimeSlice500ms(void)
+{
+	if (++g_activity_tick_500ms == 0)
+		g_activity_tick_500ms = 1;     // 0 is reserved for 'never heard'
+
+	if (g_current_function == FUNCTION_RECEIVE && IS_USER_CHANNEL(g_rx_vfo->channel_save))
+	{	// still busy
+		activity_t *pAct = &g_activity[g_rx_vfo->channel_save];
+		if (pAct->busy_500ms < 0xFFFF)
+			pAct->busy_500ms++;
+		pAct->last_heard = g_activity_tick_500ms;
+	}
+}
+
+static bool ACTIVITY_IsHot(const uint8_t Channel)
+{
+	unsigned int i;
+	for (i = 0; i < hot_count; i++)
+		if (hot_channel[i] == Channel)
+			return true;
+	return false;
+}
+
+static void ACTIVITY_BuildHotList(const uint8_t scan_list)
+{	// the most recently heard channels in the scan list, most recent first
+	const uint8_t *chans = g_scan_list_channels[(scan_list < SCAN_LIST_NUM) ? scan_list : SCAN_LIST_ALL];
+	const uint8_t  count = g_scan_list_count[(scan_list < SCAN_LIST_NUM) ? scan_list : SCAN_LIST_ALL];
+	uint16_t       age[ACTIVITY_HOT_NUM];
+	unsigned int   i;
+
+	hot_count = 0;
+	hot_index = 0;
+
+	for (i = 0; i < count; i++)
+	{
+		const uint8_t  chan = chans[i];
+		const uint16_t last = g_activity[chan].last_heard;
+		uint16_t       a;
+		unsigned int   k;
+
+		if (last == 0)
+			continue;      // never heard
+
+		a = g_activity_tick_500ms - last;
+
+		// insertion sort, youngest first
+		k = hot_count;
+		if (k >= ACTIVITY_HOT_NUM)
+		{
+			if (a >= age[ACTIVITY_HOT_NUM - 1])
+				continue;
+			k = ACTIVITY_HOT_NUM - 1;
+		}
+		else
+			hot_count++;
+
+		for ( ; k > 0 && age[k - 1] > a; k--)
+		{
+			age[k]         = age[k - 1];
+			hot_channel[k] = hot_channel[k - 1];
+		}
+
+		age[k]         = a;
+		hot_channel[k] = chan;
+	}
+}
+
+static bool ACTIVITY_Wrapped(const uint8_t Next, const uint8_t Previous, const scan_state_dir_t Direction)
+{	// true if stepping from Previous to Next went round the end of the list
+	return (Direction == SCAN_REV) ? (Next >= Previous) : (Next <= Previous);
+}
+
+static uint8_t ACTIVITY_StartPass(const uint8_t Channel, const uint8_t scan_list)
+{	// Channel is the first of a new pass, the hot channels go before it
+	ACTIVITY_BuildHotList(scan_list);
+	if (hot_count == 0)
+		return Channel;
+	resume_channel = Channel;
+	return hot_channel[hot_index++];
+}
+
+void ACTIVITY_Reset(void)
+{	// scan stopped, the next one builds a fresh hot list
+	hot_count      = 0;
+	hot_index      = 0;
+	resume_channel = 0xFF;
+}
+
+uint8_t ACTIVITY_NextChannel(const uint8_t Channel, const scan_state_dir_t Direction, const bool bCheckScanList, const uint8_t scan_list)
+{	// same as RADIO_FindNextChannel() but each pass starts with the most recently active channels
+	uint8_t      chan;
+	unsigned int i;
+
+	if (hot_index < hot_count)
+		return hot_channel[hot_index++];
+
+	if (resume_channel != 0xFF)
+	{	// hot channels done, carry on with the rest of the pass in channel order
+		chan           = resume_channel;
+		resume_channel = 0xFF;
+	}
+	else
+	{
+		chan = RADIO_FindNextChannel(Channel + Direction, Direction, bCheckScanList, scan_list);
+		if (chan == 0xFF)
+			return chan;
+
+		if (ACTIVITY_Wrapped(chan, Channel, Direction))
+		{	// start of a new pass
+			chan = ACTIVITY_StartPass(chan, scan_list);
+			if (hot_count > 0)
+				return chan;
+		}
+	}
+
+	// skip the channels already visited at the start of this pass, but not past its end
+	for (i = 0; i < hot_count && ACTIVITY_IsHot(chan); i++)
+	{
+		const uint8_t next = RADIO_FindNextChannel(chan + Direction, Direction, bCheckScanList, scan_list);
+		if (next == 0xFF)
+			return next;
+
+		if (ACTIVITY_Wrapped(next, chan, Direction))
+			return ACTIVITY_StartPass(next, scan_list);   // the rest of the pass was all hot
+
+		chan = next;
+	}
+
+	return chan;
+}
@@ -0,0 +1,42 @@
+/* Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#ifndef APP_ACTIVITY_H
+#define APP_ACTIVITY_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "app/scanner.h"
+#include "misc.h"
+
+#define ACTIVITY_HOT_NUM   8   // max number of most recently active channels visited at the start of each scan pass
+
+typedef struct {
+	uint8_t  hits;         // number of times the squelch opened, saturates at 255
+	uint16_t last_heard;   // g_activity_tick_500ms when last heard, 0 = never
+	uint16_t busy_500ms;   // total time the squelch was open, saturates
+} __attribute__((packed)) activity_t;
+
+extern activity_t g_activity[USER_CHANNEL_LAST + 1];
+extern uint16_t   g_activity_tick_500ms;
+
+void    ACTIVITY_Heard(const uint8_t Channel);
+void    ACTIVITY_TimeSlice500ms(void);
+void    ACTIVITY_Reset(void);
+uint8_t ACTIVITY_NextChannel(const uint8_t Channel, const scan_state_dir_t Direction, const bool bCheckScanList, const uint8_t scan_list);
+
+#endif
@@ -18,6 +18,9 @@
 #include <stdlib.h>  // abs()
 
 #include "app/action.h"
+#ifdef ENABLE_SCAN_ACTIVITY
+	#include "app/activity.h"
+#endif
 #ifdef ENABLE_AIRCOPY
 	#include "app/aircopy.h"
 #endif
@@ -31,6 +34,9 @@
 #include "app/menu.h"
 #include "app/scanner.h"
 #include "app/uart.h"
+#ifdef ENABLE_WATCH_SLOTS
+	#include "app/watch.h"
+#endif
 #include "ARMCM0.h"
 #include "audio.h"
 #include "board.h"
@@ -40,10 +46,12 @@
 	#include "driver/bk1080.h"
 #endif
 #include "driver/bk4819.h"
+#include "driver/eeprom.h"
 #include "driver/gpio.h"
 #include "driver/keyboard.h"
 #include "driver/st7565.h"
 #include "driver/system.h"
+#include "driver/systick.h"
 #include "driver/uart.h"
 #include "am_fix.h"
 #include "dtmf.h"
@@ -90,6 +98,22 @@ static void updateRSSI(const int vfo)
 	UI_UpdateRSSI(rssi, vfo);
 }
 
+#ifdef ENABLE_FASTER_CHANNEL_SCAN
+	static bool APP_ScanChannelIsEmpty(void)
+	{	// true if the channel is clearly empty - no need to wait for the squelch to decide
+		const uint16_t rssi  = BK4819_GetRSSI();
+		const uint8_t  noise = BK4819_GetExNoiceIndicator();
+		return (rssi < g_rx_vfo->squelch_close_rssi_thresh && noise > g_rx_vfo->squelch_close_noise_thresh);
+	}
+
+	static void APP_ScanStartDwell(void)
+	{
+		g_scan_pause_delay_in_10ms = scan_dwell_check_10ms;
+		g_scan_dwell_check         = true;
+		g_scan_hop_count++;
+	}
+#endif
+
 static void APP_CheckForIncoming(void)
 {
 	if (!g_squelch_lost)
@@ -170,6 +194,9 @@ static void APP_CheckForIncoming(void)
 
 		g_scan_pause_delay_in_10ms = scan_pause_delay_in_3_10ms;
 		g_schedule_scan_listen    = false;
+		#ifdef ENABLE_FASTER_CHANNEL_SCAN
+			g_scan_dwell_check    = false;
+		#endif
 	}
 
 	g_rx_reception_mode = RX_MODE_DETECTED;
@@ -481,12 +508,26 @@ void APP_StartListening(function_type_t Function, const bool reset_am_fix)
 
 	#ifdef ENABLE_FMRADIO
 		if (g_fm_radio_mode)
+		{
 			BK1080_Init(0, false);
+			#ifdef ENABLE_FM_WATCH
+				FM_WatchSwitched();
+			#endif
+		}
 	#endif
 
 	// clear the other vfo's rssi level (to hide the antenna symbol)
 	g_vfo_rssi_bar_level[(chan + 1) & 1u] = 0;
 
+	#ifdef ENABLE_SCAN_ACTIVITY
+		ACTIVITY_Heard(g_rx_vfo->channel_save);
+	#endif
+
+	#ifdef ENABLE_WATCH_SLOTS
+		if (g_eeprom.dual_watch != DUAL_WATCH_OFF)
+			WATCH_Heard(g_eeprom.rx_vfo);
+	#endif
+
 	GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_AUDIO_PATH);
 
 	g_enable_speaker = true;
@@ -626,16 +667,103 @@ uint32_t APP_SetFrequencyByStep(vfo_info_t *pInfo, int8_t Step)
 	return Frequency;
 }
 
+#ifdef ENABLE_SCAN_RANGES
+	static void FREQ_SetupRange(void)
+	{	// sweep between the VFO A and VFO B frequencies, kept inside the band of the RX VFO
+		const freq_band_table_t *pBand = &FREQ_BAND_TABLE[g_rx_vfo->band];
+		uint32_t                 lower = g_eeprom.vfo_info[0].freq_config_rx.frequency;
+		uint32_t                 upper = g_eeprom.vfo_info[1].freq_config_rx.frequency;
+
+		if (lower > upper)
+		{
+			const uint32_t f = lower;
+			lower = upper;
+			upper = f;
+		}
+
+		if (lower < pBand->lower)
+			lower = pBand->lower;
+		if (upper >= pBand->upper)
+			upper = pBand->upper - 1;
+
+		g_scan_range_lower  = lower;
+		g_scan_range_upper  = upper;
+		g_scan_range_hold   = false;
+		g_scan_range_active = g_eeprom.scan_range_enable && upper >= (lower + g_rx_vfo->step_freq);
+	}
+
+	static uint32_t FREQ_SweepStep(const uint32_t Frequency)
+	{
+		const uint32_t step = g_rx_vfo->step_freq;
+
+		if (g_scan_state_dir == SCAN_REV)
+			return (Frequency >= (g_scan_range_lower + step)) ? Frequency - step : g_scan_range_upper;
+
+		return ((Frequency + step) <= g_scan_range_upper) ? Frequency + step : g_scan_range_lower;
+	}
+
+	static void FREQ_NextSweep(void)
+	{	// the range is all in the one band, so the squelch/power/filter settings stay as they are
+		uint32_t Frequency = FREQ_SweepStep(g_rx_vfo->freq_config_rx.frequency);
+
+		#ifdef ENABLE_SCAN_LOCKOUT
+		{	// step over any locked out frequencies
+			unsigned int i;
+			for (i = 0; i < SCAN_LOCKOUT_FREQ_NUM && SCANNER_IsFreqLockedOut(Frequency); i++)
+				Frequency = FREQ_SweepStep(Frequency);
+		}
+		#endif
+
+		g_rx_vfo->freq_config_rx.frequency = Frequency;
+		RADIO_ApplyOffset(g_rx_vfo);
+
+		if (g_current_function == FUNCTION_FOREGROUND)
+		{	// only the PLL needs to move
+			BK4819_SetFrequencyFast(g_rx_vfo->pRX->frequency);
+		}
+		else
+		{	// we've been receiving - put everything back into a known state
+			RADIO_ConfigureSquelchAndOutputPower(g_rx_vfo);
+			RADIO_SetupRegisters(true);
+		}
+
+		#ifdef ENABLE_FASTER_CHANNEL_SCAN
+			g_scan_hop_count++;
+		#endif
+
+		g_scan_range_hold          = false;
+		g_scan_pause_delay_in_10ms = scan_sweep_dwell_10ms;
+		g_scan_keep_frequency      = false;
+		g_update_display           = true;
+	}
+#endif
+
 static void FREQ_NextChannel(void)
 {
+	#ifdef ENABLE_SCAN_RANGES
+		if (g_scan_range_active)
+		{
+			FREQ_NextSweep();
+			return;
+		}
+	#endif
+
 	g_rx_vfo->freq_config_rx.frequency = APP_SetFrequencyByStep(g_rx_vfo, g_scan_state_dir);
 
+	#ifdef ENABLE_SCAN_LOCKOUT
+	{	// step over any locked out frequencies
+		unsigned int i;
+		for (i = 0; i < SCAN_LOCKOUT_FREQ_NUM && SCANNER_IsFreqLockedOut(g_rx_vfo->freq_config_rx.frequency); i++)
+			g_rx_vfo->freq_config_rx.frequency = APP_SetFrequencyByStep(g_rx_vfo, g_scan_state_dir);
+	}
+	#endif
+
 	RADIO_ApplyOffset(g_rx_vfo);
 	RADIO_ConfigureSquelchAndOutputPower(g_rx_vfo);
 	RADIO_SetupRegisters(true);
 
 	#ifdef ENABLE_FASTER_CHANNEL_SCAN
-		g_scan_pause_delay_in_10ms = 9;   // 90ms
+		APP_ScanStartDwell();
 	#else
 		g_scan_pause_delay_in_10ms = scan_pause_delay_in_6_10ms;
 	#endif
@@ -665,7 +793,11 @@ static void USER_NextChannel(void)
 
 				if (chan1 >= 0)
 				{
-					if (RADIO_CheckValidChannel(chan1, false, 0))
+					#ifdef ENABLE_SCAN_LOCKOUT
+						if (RADIO_CheckValidChannel(chan1, false, 0) && !SCANNER_IS_LOCKED_OUT(chan1))
+					#else
+						if (RADIO_CheckValidChannel(chan1, false, 0))
+					#endif
 					{
 						g_current_scan_list = SCAN_NEXT_CHAN_SCANLIST1;
 						g_next_channel      = chan1;
@@ -676,7 +808,11 @@ static void USER_NextChannel(void)
 			case SCAN_NEXT_CHAN_SCANLIST2:
 				if (chan2 >= 0)
 				{
-					if (RADIO_CheckValidChannel(chan2, false, 0))
+					#ifdef ENABLE_SCAN_LOCKOUT
+						if (RADIO_CheckValidChannel(chan2, false, 0) && !SCANNER_IS_LOCKED_OUT(chan2))
+					#else
+						if (RADIO_CheckValidChannel(chan2, false, 0))
+					#endif
 					{
 						g_current_scan_list = SCAN_NEXT_CHAN_SCANLIST2;
 						g_next_channel      = chan2;
@@ -712,6 +848,11 @@ static void USER_NextChannel(void)
 
 	if (!enabled || chan == 0xff)
 	{
+		#ifdef ENABLE_SCAN_ACTIVITY
+			if (g_eeprom.scan_active_first)
+				chan = ACTIVITY_NextChannel(g_next_channel, g_scan_state_dir, (g_eeprom.scan_list_default < 2) ? true : false, g_eeprom.scan_list_default);
+			else
+		#endif
 		chan = RADIO_FindNextChannel(g_next_channel + g_scan_state_dir, g_scan_state_dir, (g_eeprom.scan_list_default < 2) ? true : false, g_eeprom.scan_list_default);
 		if (chan == 0xFF)
 		{	// no valid channel found
@@ -720,6 +861,19 @@ static void USER_NextChannel(void)
 //			return;
 		}
 
+		#ifdef ENABLE_SCAN_LOCKOUT
+		{	// skip the locked out channels
+			unsigned int i;
+			for (i = 0; i < USER_CHANNEL_LAST && SCANNER_IS_LOCKED_OUT(chan); i++)
+			{
+				const uint8_t next = RADIO_FindNextChannel(chan + g_scan_state_dir, g_scan_state_dir, (g_eeprom.scan_list_default < 2) ? true : false, g_eeprom.scan_list_default);
+				if (next == 0xFF)
+					break;
+				chan = next;
+			}
+		}
+		#endif
+
 		g_next_channel = chan;
 	}
 
@@ -735,7 +889,7 @@ static void USER_NextChannel(void)
 	}
 
 	#ifdef ENABLE_FASTER_CHANNEL_SCAN
-		g_scan_pause_delay_in_10ms = 9;  // 90ms .. <= ~60ms it misses signals (squelch response and/or PLL lock time) ?
+		APP_ScanStartDwell();
 	#else
 		g_scan_pause_delay_in_10ms = scan_pause_delay_in_3_10ms;
 	#endif
@@ -755,6 +909,211 @@ static void USER_NextChannel(void)
 	}
 #endif
 
+#if defined(ENABLE_PRIORITY_LOOKBACK) || defined(ENABLE_WATCH_SLOTS)
+	// the users own channel/VFO while a priority or watch slot channel is being listened to
+	static bool       temp_rx_hold;
+	static uint8_t    temp_rx_vfo;
+	static uint8_t    temp_rx_screen_channel;
+	static vfo_info_t temp_rx_vfo_info;
+	static uint16_t   temp_rx_count_down_10ms;
+
+	static void APP_TempChannelRestore(void)
+	{	// put the users own channel/VFO back as it was before it was moved
+		if (!temp_rx_hold)
+			return;
+
+		temp_rx_hold = false;
+
+		g_eeprom.screen_channel[temp_rx_vfo] = temp_rx_screen_channel;
+		g_eeprom.vfo_info[temp_rx_vfo]       = temp_rx_vfo_info;
+
+		if (g_eeprom.rx_vfo == temp_rx_vfo)
+			RADIO_SetupRegisters(true);
+
+		g_update_display = true;
+	}
+
+	static void APP_TempChannelSelect(const unsigned int vfo, const uint8_t chan)
+	{	// point the VFO at the channel with a temporary RX config, the users channel setting stays as it is
+		const uint8_t user_chan = g_eeprom.user_channel[vfo];
+
+		if (temp_rx_hold && temp_rx_vfo != vfo)
+			APP_TempChannelRestore();     // only the one VFO is held at a time
+
+		if (g_scan_state_dir == SCAN_OFF && !temp_rx_hold)
+		{	// keep the users own channel/VFO to go back to, a scan simply carries on from where it was
+			temp_rx_hold           = true;
+			temp_rx_vfo            = vfo;
+			temp_rx_screen_channel = g_eeprom.screen_channel[vfo];
+			temp_rx_vfo_info       = g_eeprom.vfo_info[vfo];
+		}
+		temp_rx_count_down_10ms = temp_channel_hold_10ms;
+
+		g_eeprom.screen_channel[vfo] = chan;
+		RADIO_ConfigureChannel(vfo, VFO_CONFIGURE_RELOAD);
+		g_eeprom.user_channel[vfo]   = user_chan;
+	}
+
+	static void APP_TempChannelTimeSlice10ms(void)
+	{	// back to the users channel once the temporary one has been quiet for a while
+		if (!temp_rx_hold)
+			return;
+
+		if (g_scan_state_dir != SCAN_OFF)
+		{	// a scan has taken over the VFO
+			temp_rx_hold = false;
+			return;
+		}
+
+		if (g_current_function != FUNCTION_FOREGROUND && g_current_function != FUNCTION_POWER_SAVE)
+			temp_rx_count_down_10ms = temp_channel_hold_10ms;
+		else
+		if (temp_rx_count_down_10ms == 0 || --temp_rx_count_down_10ms == 0)
+			APP_TempChannelRestore();
+	}
+#endif
+
+#ifdef ENABLE_PRIORITY_LOOKBACK
+
+	static void APP_PriorityGap(const uint32_t start_tick)
+	{	// record how long the audio was interrupted for
+		g_priority_gap_us = SYSTICK_GetElapsedUs(start_tick);
+
+		if (g_priority_gap_max_us < g_priority_gap_us)
+		{
+			g_priority_gap_max_us = g_priority_gap_us;
+
+			#if defined(ENABLE_UART) && defined(ENABLE_UART_DEBUG)
+				UART_printf("prio gap %u us\r\n", (unsigned int)g_priority_gap_max_us);
+			#endif
+		}
+	}
+
+	static void APP_PriorityLookBack(void)
+	{	// take a very quick look at the priority channels, then return to where we were
+		const unsigned int list = g_eeprom.scan_list_default;
+		uint8_t            chans[2];
+		uint32_t           freqs[2];
+		unsigned int       num = 0;
+		unsigned int       i;
+		uint16_t           af;
+		uint32_t           start_tick;
+
+		g_priority_lookback_count_down_10ms = priority_lookback_10ms;
+
+		if (g_current_function != FUNCTION_RECEIVE && (g_current_function != FUNCTION_FOREGROUND || g_scan_state_dir != SCAN_OFF))
+			return;
+
+		if (g_screen_to_display == DISPLAY_SCANNER || g_css_scan_mode != CSS_SCAN_MODE_OFF || g_ptt_is_pressed)
+			return;
+
+		if (g_scan_state_dir != SCAN_OFF && IS_FREQ_CHANNEL(g_next_channel))
+			return;     // don't jump out of a frequency scan
+
+		#ifdef ENABLE_FMRADIO
+			if (g_fm_radio_mode)
+				return;
+		#endif
+
+		#ifdef ENABLE_NOAA
+			if (g_is_noaa_mode)
+				return;
+		#endif
+
+		if (list >= 2 || !g_eeprom.scan_list_enabled[list])
+			return;
+
+		chans[0] = g_eeprom.scan_list_priority_ch1[list];
+		chans[1] = g_eeprom.scan_list_priority_ch2[list];
+
+		for (i = 0; i < 2; i++)
+		{
+			const uint8_t chan = chans[i];
+
+			if (chan == g_rx_vfo->channel_save || !RADIO_CheckValidChannel(chan, false, 0))
+				continue;
+
+			// fetch the frequency now, the EEPROM is too slow to be read while the audio is muted
+			EEPROM_ReadBuffer(chan * 16, &freqs[num], 4);
+			chans[num++] = chan;
+		}
+
+		if (num == 0)
+			return;
+
+		af         = BK4819_ReadRegister(BK4819_REG_47);
+		start_tick = SYSTICK_GetTick();
+
+		BK4819_SetAF(BK4819_AF_MUTE);
+
+		for (i = 0; i < num; i++)
+		{
+			BK4819_SetFrequencyFast(freqs[i]);
+			SYSTEM_DelayMs(priority_lookback_dwell_ms);
+			if (BK4819_GetRSSI() >= g_rx_vfo->squelch_open_rssi_thresh)
+				break;
+		}
+
+		if (i < num)
+		{	// priority channel is active - move over to it and let the squelch decide
+			APP_TempChannelSelect(g_eeprom.rx_vfo, chans[i]);
+			RADIO_SetupRegisters(true);
+
+			APP_PriorityGap(start_tick);
+
+			g_update_display = true;
+		}
+		else
+		{	// nothing there - back to where we were
+			BK4819_SetFrequencyFast(g_rx_vfo->pRX->frequency);
+			BK4819_WriteRegister(BK4819_REG_47, af);
+
+			APP_PriorityGap(start_tick);
+
+			// drop any squelch changes the look-back caused and re-sync with the chip
+			while (BK4819_ReadRegister(BK4819_REG_0C) & 1u)
+				BK4819_WriteRegister(BK4819_REG_02, 0);
+			g_squelch_lost = BK4819_IsSquelchOpen();
+		}
+	}
+#endif
+
+#ifdef ENABLE_WATCH_SLOTS
+	static void DUALWATCH_NextSlot(void)
+	{	// memory slots only get a quick peek on the way to the next VFO slot, so they barely slow the VFO toggling
+		unsigned int i;
+
+		for (i = 0; i < WATCH_SLOT_NUM; i++)
+		{
+			const uint8_t       slot  = WATCH_NextSlot();
+			const watch_slot_t *pSlot = &g_watch_slot[slot];
+
+			if (slot < WATCH_VFO_SLOT_NUM)
+			{
+				g_eeprom.rx_vfo = slot;
+				return;
+			}
+
+			if (pSlot->channel == g_eeprom.vfo_info[0].channel_save || pSlot->channel == g_eeprom.vfo_info[1].channel_save)
+				continue;     // already being watched on a VFO
+
+			BK4819_SetFrequencyFast(pSlot->frequency);
+			SYSTEM_DelayMs(watch_peek_dwell_ms);
+
+			if (BK4819_GetRSSI() >= g_rx_vfo->squelch_open_rssi_thresh)
+			{	// activity - move the RX VFO over to it and let the squelch decide
+				WATCH_Heard(slot);
+
+				// the users channel/VFO comes back once the slot goes quiet
+				APP_TempChannelSelect(g_eeprom.rx_vfo, pSlot->channel);
+
+				g_update_display = true;
+				return;
+			}
+		}
+	}
+#endif
+
 static void DUALWATCH_Alternate(void)
 {
 	#ifdef ENABLE_NOAA
@@ -773,7 +1132,11 @@ static void DUALWATCH_Alternate(void)
 		else
 	#endif
 	{	// toggle between VFO's
-		g_eeprom.rx_vfo = (g_eeprom.rx_vfo + 1) & 1;
+		#ifdef ENABLE_WATCH_SLOTS
+			DUALWATCH_NextSlot();
+		#else
+			g_eeprom.rx_vfo = (g_eeprom.rx_vfo + 1) & 1;
+		#endif
 		g_rx_vfo             = &g_eeprom.vfo_info[g_eeprom.rx_vfo];
 
 		if (!g_dual_watch_active)
@@ -910,6 +1273,11 @@ void APP_CheckRadioInterrupts(void)
 		{
 			g_squelch_lost = true;
 			BK4819_ToggleGpioOut(BK4819_GPIO0_PIN28_GREEN, true);
+
+			#ifdef ENABLE_FM_WATCH
+				if (g_fm_radio_mode)
+					FM_WatchSquelchOpen();
+			#endif
 		}
 
 		if (interrupt_status_bits & BK4819_REG_02_SQUELCH_FOUND)
@@ -1080,6 +1448,38 @@ void APP_Update(void)
 		if (g_voice_write_index == 0)
 	#endif
 	{
+		#ifdef ENABLE_FASTER_CHANNEL_SCAN
+			if (g_scan_dwell_check && g_schedule_scan_listen)
+			{	// early look at the channel
+				g_scan_dwell_check = false;
+
+				if (g_scan_state_dir != SCAN_OFF &&
+				    g_current_function != FUNCTION_INCOMING &&
+				   !APP_ScanChannelIsEmpty())
+				{	// borderline - give the squelch the rest of the full dwell time
+					g_scan_pause_delay_in_10ms = scan_dwell_full_10ms - scan_dwell_check_10ms;
+					g_schedule_scan_listen     = false;
+				}
+			}
+		#endif
+
+		#ifdef ENABLE_SCAN_RANGES
+			if (g_scan_range_active &&
+			   !g_scan_range_hold &&
+			    g_schedule_scan_listen &&
+			    g_scan_state_dir != SCAN_OFF &&
+			    g_current_function == FUNCTION_FOREGROUND &&
+			    IS_FREQ_CHANNEL(g_next_channel))
+			{	// end of the short sweep dwell
+				if (BK4819_GetRSSI() >= g_rx_vfo->squelch_open_rssi_thresh)
+				{	// activity - stop hopping and give the squelch time to open
+					g_scan_range_hold          = true;
+					g_scan_pause_delay_in_10ms = scan_pause_delay_in_3_10ms;
+					g_schedule_scan_listen     = false;
+				}
+			}
+		#endif
+
 		if (g_screen_to_display != DISPLAY_SCANNER &&
 		    g_scan_state_dir != SCAN_OFF &&
 		    g_schedule_scan_listen &&
@@ -1113,7 +1513,7 @@ void APP_Update(void)
 		if (g_css_scan_mode == CSS_SCAN_MODE_SCANNING && g_schedule_scan_listen)
 	#endif
 	{
-		MENU_SelectNextCode();
+		MENU_CssScanNext();
 
 		g_schedule_scan_listen = false;
 	}
@@ -1133,6 +1533,19 @@ void APP_Update(void)
 		}
 	#endif
 
+	#ifdef ENABLE_PRIORITY_LOOKBACK
+		#ifdef ENABLE_VOICE
+			if (g_voice_write_index == 0)
+		#endif
+		{
+			if (g_schedule_priority_lookback)
+			{
+				g_schedule_priority_lookback = false;
+				APP_PriorityLookBack();
+			}
+		}
+	#endif
+
 	// toggle between the VFO's if dual watch is enabled
 	if (g_screen_to_display != DISPLAY_SCANNER && g_eeprom.dual_watch != DUAL_WATCH_OFF)
 	{
@@ -1498,6 +1911,9 @@ void APP_TimeSlice10ms(void)
 			AM_fix_10ms(g_eeprom.rx_vfo);
 	#endif
 
+	// releases the display once the last DMA page is out
+	ST7565_IsBusy();
+
 	if (g_reduced_service)
 		return;
 
@@ -1512,8 +1928,11 @@ void APP_TimeSlice10ms(void)
 		#endif
 	}
 
-	if (g_update_display)
-		GUI_DisplayScreen();
+	#if defined(ENABLE_PRIORITY_LOOKBACK) || defined(ENABLE_WATCH_SLOTS)
+		APP_TempChannelTimeSlice10ms();
+	#endif
+
+	GUI_TimeSlice10ms();
 
 	if (g_update_status)
 		UI_DisplayStatus(false);
@@ -1521,6 +1940,14 @@ void APP_TimeSlice10ms(void)
 	// Skipping authentic device checks
 
 	#ifdef ENABLE_FMRADIO
+		// power up waits and seek start up
+		BK1080_TimeSlice10ms();
+
+		#ifdef ENABLE_FM_WATCH
+			// BK4819 sleep/wake duty cycle, counted in 10ms ticks
+			FM_WatchTimeSlice10ms();
+		#endif
+
 		if (g_fm_radio_mode && g_fm_radio_count_down_500ms > 0)
 			return;
 	#endif
@@ -1617,6 +2044,7 @@ void APP_TimeSlice10ms(void)
 	{
 		uint32_t                 Result;
 		int32_t                  Delta;
+		uint8_t                  HitsNeeded;
 		uint16_t                 CtcssFreq;
 		BK4819_CSS_scan_result_t ScanResult;
 
@@ -1662,6 +2090,9 @@ void APP_TimeSlice10ms(void)
 				Delta = Result - g_scan_frequency;
 				g_scan_hit_count = (abs(Delta) < 100) ? g_scan_hit_count + 1 : 0;
 
+				// a strong carrier that reads back within 200Hz is trusted after fewer hits
+				HitsNeeded = (BK4819_GetRSSI() >= scan_freq_strong_rssi && abs(Delta) < 20) ? 2 : 3;
+
 				BK4819_DisableFrequencyScan();
 
 				#if 0
@@ -1673,7 +2104,7 @@ void APP_TimeSlice10ms(void)
 				}
 				#endif
 
-				if (g_scan_hit_count < 3)
+				if (g_scan_hit_count < HitsNeeded)
 				{	// keep scanning for an RF carrier
 					BK4819_EnableFrequencyScan();
 				}
@@ -1687,6 +2118,7 @@ void APP_TimeSlice10ms(void)
 					g_scan_css_result_type     = 0xFF;
 					g_scan_hit_count           = 0;
 					g_scan_use_css_result      = false;
+					g_scan_freq_lock_10ms      = g_scan_freq_css_timer_10ms;
 					g_scan_freq_css_timer_10ms = 0;
 					g_scan_css_state           = SCAN_CSS_STATE_SCANNING;
 
@@ -1764,6 +2196,9 @@ void APP_TimeSlice10ms(void)
 					}
 				}
 
+				if (g_scan_css_state == SCAN_CSS_STATE_FOUND)
+					g_scan_css_lock_10ms = g_scan_freq_css_timer_10ms;
+
 				if (g_scan_css_state == SCAN_CSS_STATE_OFF ||
 				    g_scan_css_state == SCAN_CSS_STATE_SCANNING)
 				{	// re-start scan
@@ -1823,10 +2258,28 @@ void cancelUserInputModes(void)
 // this is called once every 500ms
 void APP_TimeSlice500ms(void)
 {
-	bool exit_menu = false;
+	static uint8_t ticks_500ms;
+	bool           exit_menu = false;
 
 	// Skipped authentic device check
 
+	if ((++ticks_500ms & 1u) == 0)
+		ST7565_TimeSlice1s();
+
+	#ifdef ENABLE_SCAN_ACTIVITY
+		ACTIVITY_TimeSlice500ms();
+	#endif
+
+	#ifdef ENABLE_WATCH_SLOTS
+		WATCH_TimeSlice500ms();
+	#endif
+
+	#ifdef ENABLE_SCAN_LOCKOUT
+		if (g_scan_lockout_count_down_500ms > 0)
+			if (--g_scan_lockout_count_down_500ms == 0)
+				SCANNER_ClearLockouts();     // lockouts have expired
+	#endif
+
 	if (g_keypad_locked > 0)
 		if (--g_keypad_locked == 0)
 			g_update_display = true;
@@ -2020,6 +2473,23 @@ void APP_TimeSlice500ms(void)
 	if (g_current_function != FUNCTION_POWER_SAVE && g_current_function != FUNCTION_TRANSMIT)
 		updateRSSI(g_eeprom.rx_vfo);
 
+	#ifdef ENABLE_FASTER_CHANNEL_SCAN
+		if ((g_battery_check_counter & 1) == 0)
+		{	// once a second
+			if (g_scan_state_dir != SCAN_OFF || g_scan_channels_per_sec > 0)
+			{
+				g_scan_channels_per_sec = g_scan_hop_count;
+				g_update_status         = true;
+
+				#if defined(ENABLE_UART) && defined(ENABLE_UART_DEBUG)
+					if (g_scan_state_dir != SCAN_OFF)
+						UART_printf("scan %u ch/s\r\n", g_scan_channels_per_sec);
+				#endif
+			}
+			g_scan_hop_count = 0;
+		}
+	#endif
+
 	#ifdef ENABLE_FMRADIO
 		if (!g_ptt_is_pressed && g_fm_resume_count_down_500ms > 0)
 		{
@@ -2183,7 +2653,12 @@ void CHANNEL_Next(const bool flag, const scan_state_dir_t scan_direction)
 	else
 	{	// frequency mode
 		if (flag)
+		{
 			g_restore_frequency = g_rx_vfo->freq_config_rx.frequency;
+			#ifdef ENABLE_SCAN_RANGES
+				FREQ_SetupRange();
+			#endif
+		}
 		FREQ_NextChannel();
 	}
 
@@ -2205,6 +2680,12 @@ static void APP_ProcessKey(const key_code_t Key, const bool key_pressed, const b
 	if (Key != KEY_INVALID && Key != KEY_PTT)
 		RADIO_Setg_vfo_state(VFO_STATE_NORMAL);
 
+	#if defined(ENABLE_PRIORITY_LOOKBACK) || defined(ENABLE_WATCH_SLOTS)
+		// keys act on the users own channel, not on a priority/watch slot channel being listened to
+		if (Key != KEY_INVALID && Key != KEY_PTT)
+			APP_TempChannelRestore();
+	#endif
+
 	const bool backlight_was_on = GPIO_CheckBit(&GPIOB->DATA, GPIOB_PIN_BACKLIGHT);
 
 	if (Key == KEY_EXIT && !backlight_was_on && g_eeprom.backlight > 0)
@@ -2217,6 +2698,9 @@ static void APP_ProcessKey(const key_code_t Key, const bool key_pressed, const b
 	if (g_current_function == FUNCTION_POWER_SAVE)
 		FUNCTION_Select(FUNCTION_FOREGROUND);
 
+	// whatever the key changes is drawn on the next tick, not held back by the frame rate cap
+	g_gui_input_feedback = true;
+
 	g_battery_save_count_down_10ms = battery_save_count_10ms;
 
 	if (g_eeprom.auto_keypad_lock)
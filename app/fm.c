@@ -24,6 +24,9 @@
 #include "audio.h"
 #include "bsp/dp32g030/gpio.h"
 #include "driver/bk1080.h"
+#ifdef ENABLE_FM_WATCH
+	#include "driver/bk4819.h"
+#endif
 #include "driver/eeprom.h"
 #include "driver/gpio.h"
 #include "functions.h"
@@ -48,6 +51,21 @@ bool              g_fm_auto_scan;
 uint8_t           g_fm_resume_count_down_500ms;
 uint16_t          g_fm_restore_count_down_10ms;
 
+#ifdef ENABLE_FM_WATCH
+	bool              g_fm_watch;
+	uint16_t          g_fm_watch_latency_10ms;   // last watch window start to ham audio, 0 = not measured yet
+
+	static bool       fm_watch_asleep;
+	static bool       fm_watch_muted;
+	static bool       fm_watch_triggered;
+	static uint16_t   fm_watch_count_down_10ms;
+	static uint16_t   fm_watch_tick_10ms;
+	static uint16_t   fm_watch_window_tick_10ms;
+#endif
+
+static uint16_t   fm_scan_rank[ARRAY_SIZE(g_fm_channels)];   // RSSI << 4 | SNR of each found station
+static uint16_t   fm_seek_polls;
+
 bool FM_CheckValidChannel(uint8_t Channel)
 {
 	return (Channel < ARRAY_SIZE(g_fm_channels) && (g_fm_channels[Channel] >= 760 && g_fm_channels[Channel] < 1080)) ? true : false;
@@ -93,6 +111,10 @@ int FM_ConfigureChannelState(void)
 
 void FM_TurnOff(void)
 {
+	#ifdef ENABLE_FM_WATCH
+		FM_WatchStop();
+	#endif
+
 	g_fm_radio_mode              = false;
 	g_fm_scan_state             = FM_SCAN_OFF;
 	g_fm_restore_count_down_10ms = 0;
@@ -151,6 +173,9 @@ void FM_Tune(uint16_t Frequency, int8_t Step, bool flag)
 
 void FM_PlayAndUpdate(void)
 {
+	if (g_fm_auto_scan && g_fm_scan_state != FM_SCAN_OFF)
+		BK1080_StopSeek();
+
 	g_fm_scan_state = FM_SCAN_OFF;
 
 	if (g_fm_auto_scan)
@@ -376,6 +401,14 @@ static void FM_Key_DIGITS(key_code_t Key, bool key_pressed, bool key_held)
 				ACTION_Scan(false);
 				break;
 
+			#ifdef ENABLE_FM_WATCH
+				case KEY_4:
+					g_fm_watch = !g_fm_watch;
+					if (!g_fm_watch)
+						FM_WatchStop();
+					break;
+			#endif
+
 			default:
 				g_beep_to_play = BEEP_500HZ_60MS_DOUBLE_BEEP_OPTIONAL;
 				break;
@@ -615,44 +648,214 @@ void FM_ProcessKeys(key_code_t Key, bool key_pressed, bool key_held)
 	}
 }
 
-void FM_Play(void)
-{
-	if (!FM_CheckFrequencyLock(g_eeprom.fm_frequency_playing, g_eeprom.fm_lower_limit))
+static void FM_AddRanked(uint16_t Frequency, uint16_t Rank)
+{	// g_fm_channels is kept sorted strongest first, the weakest drops off once it's full
+	unsigned int i;
+	unsigned int Count = g_fm_channel_position;
+
+	if (Count >= ARRAY_SIZE(g_fm_channels))
 	{
-		if (!g_fm_auto_scan)
-		{
-			g_fm_play_count_down_10ms = 0;
-			g_fm_found_frequency    = true;
+		if (Rank <= fm_scan_rank[ARRAY_SIZE(g_fm_channels) - 1])
+			return;
+		Count = ARRAY_SIZE(g_fm_channels) - 1;
+	}
+
+	for (i = Count; i > 0 && fm_scan_rank[i - 1] < Rank; i--)
+	{
+		g_fm_channels[i] = g_fm_channels[i - 1];
+		fm_scan_rank[i]  = fm_scan_rank[i - 1];
+	}
 
-			if (!g_eeprom.fm_is_channel_mode)
-				g_eeprom.fm_selected_frequency = g_eeprom.fm_frequency_playing;
+	g_fm_channels[i]      = Frequency;
+	fm_scan_rank[i]       = Rank;
+	g_fm_channel_position = Count + 1;
+}
 
-			GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_AUDIO_PATH);
-			g_enable_speaker = true;
+void FM_StartAutoScan(void)
+{
+	GPIO_ClearBit(&GPIOC->DATA, GPIOC_PIN_AUDIO_PATH);
 
-			GUI_SelectNextDisplay(DISPLAY_FM);
+	g_enable_speaker = false;
+
+	g_schedule_fm                 = false;
+	g_fm_found_frequency          = false;
+	g_ask_to_save                 = false;
+	g_ask_to_delete               = false;
+	g_eeprom.fm_frequency_playing = g_eeprom.fm_lower_limit;
+
+	// start one channel below the limit so a station sitting on it is found too
+	BK1080_SetFrequency((g_eeprom.fm_lower_limit > 760) ? g_eeprom.fm_lower_limit - 1 : 760);
+	BK1080_StartSeek(true);
+
+	fm_seek_polls             = 0;
+	g_fm_scan_state           = FM_CHANNEL_UP;
+	g_fm_play_count_down_10ms = fm_seek_poll_10ms;
+}
+
+static void FM_AutoScanPoll(void)
+{	// STC isn't looked at until the driver has actually started the seek
+	const uint16_t Status = BK1080_IsBusy() ? 0 : BK1080_ReadRegister(BK1080_REG_10);
+
+	if ((Status & BK1080_REG_10_MASK_STC) == 0)
+	{	// still seeking
+		if (++fm_seek_polls < (fm_seek_timeout_10ms / fm_seek_poll_10ms))
+		{
+			g_fm_play_count_down_10ms = fm_seek_poll_10ms;
 			return;
 		}
+	}
+	else
+	{
+		const uint16_t Frequency = BK1080_GetFrequency();
+		const uint16_t SNR       = BK1080_REG_07_GET_SNR(BK1080_ReadRegister(BK1080_REG_07));
 
-		if (g_fm_channel_position < 20)
-			g_fm_channels[g_fm_channel_position++] = g_eeprom.fm_frequency_playing;
+		BK1080_StopSeek();
 
-		if (g_fm_channel_position >= 20)
+		if ((Status & BK1080_REG_10_MASK_SFBL) == 0 && Frequency <= g_eeprom.fm_upper_limit)
 		{
-			FM_PlayAndUpdate();
+			if (Frequency >= g_eeprom.fm_lower_limit)
+				FM_AddRanked(Frequency, (BK1080_REG_10_GET_RSSI(Status) << 4) | SNR);
+
+			g_eeprom.fm_frequency_playing = Frequency;
+
+			fm_seek_polls             = 0;
+			g_fm_play_count_down_10ms = fm_seek_poll_10ms;
+			BK1080_StartSeek(true);
+
 			GUI_SelectNextDisplay(DISPLAY_FM);
 			return;
 		}
 	}
 
-	if (g_fm_auto_scan && g_eeprom.fm_frequency_playing >= g_eeprom.fm_upper_limit)
-		FM_PlayAndUpdate();
-	else
-		FM_Tune(g_eeprom.fm_frequency_playing, g_fm_scan_state, false);
+	// band edge reached or the seek timed out
+	FM_PlayAndUpdate();
+	GUI_SelectNextDisplay(DISPLAY_FM);
+}
+
+void FM_Play(void)
+{
+	if (g_fm_auto_scan)
+	{
+		FM_AutoScanPoll();
+		return;
+	}
+
+	if (!FM_CheckFrequencyLock(g_eeprom.fm_frequency_playing, g_eeprom.fm_lower_limit))
+	{
+		g_fm_play_count_down_10ms = 0;
+		g_fm_found_frequency    = true;
+
+		if (!g_eeprom.fm_is_channel_mode)
+			g_eeprom.fm_selected_frequency = g_eeprom.fm_frequency_playing;
+
+		GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_AUDIO_PATH);
+		g_enable_speaker = true;
+
+		GUI_SelectNextDisplay(DISPLAY_FM);
+		return;
+	}
+
+	FM_Tune(g_eeprom.fm_frequency_playing, g_fm_scan_state, false);
 
 	GUI_SelectNextDisplay(DISPLAY_FM);
 }
 
+#ifdef ENABLE_FM_WATCH
+	static bool FM_WatchIdle(void)
+	{	// only while the broadcast is actually playing
+		return g_fm_watch                         &&
+		       g_fm_radio_mode                    &&
+		       g_fm_scan_state == FM_SCAN_OFF     &&
+		       g_current_function == FUNCTION_FOREGROUND &&
+		       g_fm_restore_count_down_10ms == 0  &&
+		       g_fm_resume_count_down_500ms == 0  &&
+		       !g_ptt_is_pressed;
+	}
+
+	static void FM_WatchWake(void)
+	{
+		BK4819_Conditional_RX_TurnOn_and_GPIO6_Enable();
+		FUNCTION_Init();
+
+		fm_watch_asleep           = false;
+		fm_watch_window_tick_10ms = fm_watch_tick_10ms;
+	}
+
+	void FM_WatchStop(void)
+	{
+		if (fm_watch_asleep)
+			FM_WatchWake();
+
+		if (fm_watch_muted)
+			BK1080_Mute(false);
+
+		fm_watch_muted           = false;
+		fm_watch_triggered       = false;
+		fm_watch_count_down_10ms = 0;
+	}
+
+	void FM_WatchTimeSlice10ms(void)
+	{	// the BK4819 is woken for a short window every so often, the squelch
+		// interrupt (FM_WatchSquelchOpen) does the rest
+		fm_watch_tick_10ms++;
+
+		if (!FM_WatchIdle())
+		{	// watch off or the ham side is busy, keep the BK4819 awake
+			if (fm_watch_asleep)
+				FM_WatchWake();
+			return;
+		}
+
+		if (fm_watch_muted && !g_squelch_lost)
+		{	// the squelch opened but nothing was let through, back to the broadcast
+			BK1080_Mute(false);
+			fm_watch_muted     = false;
+			fm_watch_triggered = false;
+		}
+
+		if (fm_watch_count_down_10ms > 0 && --fm_watch_count_down_10ms > 0)
+			return;
+
+		if (fm_watch_asleep)
+		{
+			FM_WatchWake();
+			fm_watch_count_down_10ms = fm_watch_window_10ms;
+		}
+		else
+		if (!g_squelch_lost)
+		{	// nothing heard in this window
+			BK4819_Sleep();
+			BK4819_ToggleGpioOut(BK4819_GPIO6_PIN2, false);
+
+			fm_watch_asleep          = true;
+			fm_watch_count_down_10ms = fm_watch_sleep_10ms;
+		}
+	}
+
+	void FM_WatchSquelchOpen(void)
+	{	// called from the squelch interrupt, the broadcast is muted straight
+		// away rather than when the ham audio is switched in
+		if (!g_fm_watch || fm_watch_muted || g_current_function != FUNCTION_FOREGROUND)
+			return;
+
+		BK1080_Mute(true);
+
+		fm_watch_muted     = true;
+		fm_watch_triggered = true;
+	}
+
+	void FM_WatchSwitched(void)
+	{	// the ham audio is on and the BK1080 powered down
+		fm_watch_muted = false;
+
+		if (!fm_watch_triggered)
+			return;
+
+		fm_watch_triggered      = false;
+		g_fm_watch_latency_10ms = fm_watch_tick_10ms - fm_watch_window_tick_10ms;
+	}
+#endif
+
 void FM_Start(void)
 {
 	g_fm_radio_mode              = true;
@@ -41,6 +41,10 @@ extern bool              g_fm_found_frequency;
 extern bool              g_fm_auto_scan;
 extern uint8_t           g_fm_resume_count_down_500ms;
 extern uint16_t          g_fm_restore_count_down_10ms;
+#ifdef ENABLE_FM_WATCH
+	extern bool          g_fm_watch;
+	extern uint16_t      g_fm_watch_latency_10ms;
+#endif
 
 bool    FM_CheckValidChannel(uint8_t Channel);
 uint8_t FM_FindNextChannel(uint8_t Channel, uint8_t Direction);
@@ -54,6 +58,13 @@ int     FM_CheckFrequencyLock(uint16_t Frequency, uint16_t LowerLimit);
 
 void    FM_ProcessKeys(key_code_t Key, bool bKeyPressed, bool bKeyHeld);
 
+void    FM_StartAutoScan(void);
+#ifdef ENABLE_FM_WATCH
+	void FM_WatchTimeSlice10ms(void);
+	void FM_WatchSquelchOpen(void);
+	void FM_WatchSwitched(void);
+	void FM_WatchStop(void);
+#endif
 void    FM_Play(void);
 void    FM_Start(void);
 
@@ -33,9 +33,10 @@
 #include "radio.h"
 #include "settings.h"
 #include "ui/inputbox.h"
+#include "ui/main.h"
 #include "ui/ui.h"
-#ifdef ENABLE_SPECTRUM
-//	#include "app/spectrum.h"
+#ifdef ENABLE_PANADAPTER
+	#include "app/spectrum.h"
 #endif
 
 void toggle_chan_scanlist(void)
@@ -221,6 +222,23 @@ static void processFKeyFunction(const key_code_t Key, const bool beep)
 				g_request_save_vfo   = true;
 				g_vfo_configure_mode = VFO_CONFIGURE_RELOAD;
 
+			#elif defined(ENABLE_PANADAPTER)
+				#ifdef ENABLE_VOX
+					if (!beep)
+					{	// long-press '5' keeps the scanlist toggle
+						toggle_chan_scanlist();
+						break;
+					}
+				#endif
+
+				// F+5
+				APP_RunSpectrum();      // returns when the user exits the band scope
+				UI_MainInvalidate();
+
+				RADIO_SetupRegisters(true);
+				g_request_display_screen = DISPLAY_MAIN;
+				g_update_status          = true;
+
 			#else
 				#ifdef ENABLE_VOX
 					toggle_chan_scanlist();
@@ -687,6 +705,21 @@ static void MAIN_Key_STAR(bool key_pressed, bool key_held)
 
 			g_request_display_screen = DISPLAY_MAIN;
 		}
+		#ifdef ENABLE_SCAN_LOCKOUT
+			else
+			if (g_scan_state_dir != SCAN_OFF && g_css_scan_mode == CSS_SCAN_MODE_OFF)
+			{	// lock out the current channel/frequency and move on
+				if (!SCANNER_ToggleLockout())
+				{	// it's the only channel left unlocked
+					g_beep_to_play = BEEP_500HZ_60MS_DOUBLE_BEEP_OPTIONAL;
+					return;
+				}
+
+				CHANNEL_Next(false, g_scan_state_dir);
+				g_scan_pause_delay_in_10ms = 1;
+				g_schedule_scan_listen     = false;
+			}
+		#endif
 	}
 	else
 	{	// with the F-key
@@ -76,6 +76,19 @@
 	}
 #endif
 
+static bool css_scan_direct;   // true = the BK4819 CxCSS detector is armed
+
+static void MENU_SelectCode(void);
+
+static void MENU_CssScanArm(void)
+{	// let the BK4819 tell us what tone/code is there
+	BK4819_SetScanFrequency(g_rx_vfo->pRX->frequency);
+
+	css_scan_direct            = true;
+	g_scan_pause_delay_in_10ms = scan_freq_css_delay_10ms;
+	g_schedule_scan_listen     = false;
+}
+
 void MENU_StartCssScan(int8_t Direction)
 {
 	g_css_scan_mode  = CSS_SCAN_MODE_SCANNING;
@@ -85,15 +98,60 @@ void MENU_StartCssScan(int8_t Direction)
 
 	RADIO_SelectVfos();
 
+	// a real code is needed before arming, a carrier in the arm window
+	// takes its code type from here and CODE_TYPE_OFF would be 'found'
 	MENU_SelectNextCode();
 
-	g_scan_pause_delay_in_10ms = scan_pause_delay_in_2_10ms;
-	g_schedule_scan_listen     = false;
+	MENU_CssScanArm();
+}
+
+void MENU_CssScanNext(void)
+{	// end of a CSS scan window
+	uint32_t                 cdcss_code;
+	uint16_t                 ctcss_freq;
+	BK4819_CSS_scan_result_t result;
+	uint8_t                  code;
+
+	if (!css_scan_direct)
+	{	// the last code we tried didn't open the squelch, take another direct look
+		MENU_CssScanArm();
+		return;
+	}
+
+	css_scan_direct = false;
+
+	result = BK4819_GetCxCSSScanResult(&cdcss_code, &ctcss_freq);
+
+	if (g_menu_cursor == MENU_R_DCS && result == BK4819_CSS_RESULT_CDCSS)
+	{	// inverted codes are rotations of normal ones, so this always finds the normal code
+		code = DCS_GetCdcssCode(cdcss_code);
+		if (code != 0xFF)
+		{
+			g_sub_menu_selection = code + 1;
+			MENU_SelectCode();
+			return;
+		}
+	}
+	else
+	if (g_menu_cursor == MENU_R_CTCS && result == BK4819_CSS_RESULT_CTCSS)
+	{
+		code = DCS_GetCtcssCode(ctcss_freq);
+		if (code != 0xFF)
+		{
+			g_sub_menu_selection = code + 1;
+			MENU_SelectCode();
+			return;
+		}
+	}
+
+	// nothing detected - fall back to trying the next code in the list
+	MENU_SelectNextCode();
 }
 
 void MENU_StopCssScan(void)
 {
 	g_css_scan_mode = CSS_SCAN_MODE_OFF;
+	css_scan_direct = false;
 	g_update_status = true;
 
 	RADIO_SetupRegisters(true);
@@ -241,6 +299,12 @@ int MENU_GetLimits(uint8_t Cursor, int32_t *pMin, int32_t *pMax)
 		case MENU_S_ADD1:
 		case MENU_S_ADD2:
 		case MENU_STE:
+		#ifdef ENABLE_SCAN_RANGES
+			case MENU_SC_RNG:
+		#endif
+		#ifdef ENABLE_SCAN_ACTIVITY
+			case MENU_SC_ACT:
+		#endif
 		case MENU_D_ST:
 		case MENU_D_DCD:
 		case MENU_D_LIVE_DEC:
@@ -590,6 +654,18 @@ void MENU_AcceptSetting(void)
 			g_eeprom.scan_resume_mode = g_sub_menu_selection;
 			break;
 
+		#ifdef ENABLE_SCAN_RANGES
+			case MENU_SC_RNG:
+				g_eeprom.scan_range_enable = g_sub_menu_selection;
+				break;
+		#endif
+
+		#ifdef ENABLE_SCAN_ACTIVITY
+			case MENU_SC_ACT:
+				g_eeprom.scan_active_first = g_sub_menu_selection;
+				break;
+		#endif
+
 		case MENU_MDF:
 			g_eeprom.channel_display_mode = g_sub_menu_selection;
 			break;
@@ -863,6 +939,12 @@ void MENU_SelectNextCode(void)
 
 	g_sub_menu_selection = NUMBER_AddWithWraparound(g_sub_menu_selection, g_menu_scroll_direction, 1, UpperLimit);
 
+	MENU_SelectCode();
+}
+
+static void MENU_SelectCode(void)
+{	// set up the receiver for the tone/code in g_sub_menu_selection and give the squelch time to open
+
 	if (g_menu_cursor == MENU_R_DCS)
 	{
 		if (g_sub_menu_selection > 104)
@@ -1047,6 +1129,18 @@ void MENU_ShowCurrentSetting(void)
 			g_sub_menu_selection = g_eeprom.scan_resume_mode;
 			break;
 
+		#ifdef ENABLE_SCAN_RANGES
+			case MENU_SC_RNG:
+				g_sub_menu_selection = g_eeprom.scan_range_enable;
+				break;
+		#endif
+
+		#ifdef ENABLE_SCAN_ACTIVITY
+			case MENU_SC_ACT:
+				g_sub_menu_selection = g_eeprom.scan_active_first;
+				break;
+		#endif
+
 		case MENU_MDF:
 			g_sub_menu_selection = g_eeprom.channel_display_mode;
 			break;
@@ -28,6 +28,7 @@ void MENU_AcceptSetting(void);
 void MENU_SelectNextCode(void);
 void MENU_ShowCurrentSetting(void);
 void MENU_StartCssScan(int8_t Direction);
+void MENU_CssScanNext(void);
 void MENU_StopCssScan(void);
 
 void MENU_ProcessKeys(key_code_t Key, bool key_pressed, bool key_held);
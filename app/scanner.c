@@ -14,6 +14,11 @@
  *     limitations under the License.
  */
 
+#include <string.h>
+
+#ifdef ENABLE_SCAN_ACTIVITY
+	#include "app/activity.h"
+#endif
 #include "app/dtmf.h"
 #include "app/generic.h"
 #include "app/scanner.h"
@@ -40,9 +45,28 @@ volatile bool     g_schedule_scan_listen = true;
 volatile uint16_t g_scan_pause_delay_in_10ms;
 uint16_t          g_scan_freq_css_timer_10ms;
 uint8_t           g_scan_hit_count;
+uint16_t          g_scan_freq_lock_10ms;
+uint16_t          g_scan_css_lock_10ms;
 bool              g_scan_use_css_result;
 scan_state_dir_t  g_scan_state_dir;
 bool              g_scan_keep_frequency;
+#ifdef ENABLE_FASTER_CHANNEL_SCAN
+	bool          g_scan_dwell_check;        // true = early empty channel test is pending
+	uint16_t      g_scan_hop_count;          // channels visited since the last rate update
+	uint16_t      g_scan_channels_per_sec;
+#endif
+#ifdef ENABLE_SCAN_RANGES
+	bool          g_scan_range_active;       // true = sweeping between the two VFO frequencies
+	bool          g_scan_range_hold;         // true = activity seen, the squelch has the final say
+	uint32_t      g_scan_range_lower;
+	uint32_t      g_scan_range_upper;
+#endif
+#ifdef ENABLE_SCAN_LOCKOUT
+	uint8_t       g_scan_lockout[(USER_CHANNEL_LAST + 8) / 8];     // one bit per memory channel
+	uint32_t      g_scan_lockout_freq[SCAN_LOCKOUT_FREQ_NUM];      // locked out VFO frequencies, oldest first
+	uint8_t       g_scan_lockout_freq_count;
+	uint16_t      g_scan_lockout_count_down_500ms;
+#endif
 
 static void SCANNER_Key_DIGITS(key_code_t Key, bool key_pressed, bool key_held)
 {
@@ -466,6 +490,8 @@ void SCANNER_Start(void)
 	g_squelch_lost             = false;
 	g_scanner_edit_state       = SCAN_EDIT_STATE_NONE;
 	g_scan_freq_css_timer_10ms = 0;
+	g_scan_freq_lock_10ms      = 0;
+	g_scan_css_lock_10ms       = 0;
 //	g_flag_start_scan          = false;
 
 	g_update_status = true;
@@ -480,6 +506,10 @@ void SCANNER_Stop(void)
 
 	g_scan_state_dir = SCAN_OFF;
 
+	#ifdef ENABLE_SCAN_ACTIVITY
+		ACTIVITY_Reset();
+	#endif
+
 	if (!g_scan_keep_frequency)
 	{
 		if (g_next_channel <= USER_CHANNEL_LAST)
@@ -515,3 +545,73 @@ void SCANNER_Stop(void)
 
 	g_update_status = true;
 }
+
+#ifdef ENABLE_SCAN_LOCKOUT
+	bool SCANNER_ToggleLockout(void)
+	{	// lock out (or release) the channel/frequency the RX VFO is sat on, RAM only
+		// returns false if that would lock out the last unlocked channel of the scan list
+		const uint8_t chan = g_rx_vfo->channel_save;
+
+		if (IS_USER_CHANNEL(chan))
+		{
+			if (!SCANNER_IS_LOCKED_OUT(chan))
+			{
+				const uint8_t  list  = (g_eeprom.scan_list_default < SCAN_LIST_NUM) ? g_eeprom.scan_list_default : SCAN_LIST_ALL;
+				const uint8_t *chans = g_scan_list_channels[list];
+				unsigned int   i;
+
+				for (i = 0; i < g_scan_list_count[list]; i++)
+					if (chans[i] != chan && !SCANNER_IS_LOCKED_OUT(chans[i]))
+						break;
+
+				if (i >= g_scan_list_count[list])
+					return false;   // nothing left to scan
+			}
+
+			g_scan_lockout[chan >> 3] ^= 1u << (chan & 7u);
+		}
+		else
+		{
+			const uint32_t Frequency = g_rx_vfo->freq_config_rx.frequency;
+			unsigned int   i;
+
+			for (i = 0; i < g_scan_lockout_freq_count; i++)
+				if (g_scan_lockout_freq[i] == Frequency)
+					break;
+
+			if (i < g_scan_lockout_freq_count)
+			{	// already locked out - release it
+				memmove(&g_scan_lockout_freq[i], &g_scan_lockout_freq[i + 1], (--g_scan_lockout_freq_count - i) * sizeof(g_scan_lockout_freq[0]));
+			}
+			else
+			{
+				if (g_scan_lockout_freq_count >= ARRAY_SIZE(g_scan_lockout_freq))
+				{	// full - drop the oldest
+					memmove(&g_scan_lockout_freq[0], &g_scan_lockout_freq[1], (ARRAY_SIZE(g_scan_lockout_freq) - 1) * sizeof(g_scan_lockout_freq[0]));
+					g_scan_lockout_freq_count--;
+				}
+				g_scan_lockout_freq[g_scan_lockout_freq_count++] = Frequency;
+			}
+		}
+
+		g_scan_lockout_count_down_500ms = scan_lockout_expire_500ms;
+
+		return true;
+	}
+
+	bool SCANNER_IsFreqLockedOut(const uint32_t Frequency)
+	{
+		unsigned int i;
+		for (i = 0; i < g_scan_lockout_freq_count; i++)
+			if (g_scan_lockout_freq[i] == Frequency)
+				return true;
+		return false;
+	}
+
+	void SCANNER_ClearLockouts(void)
+	{
+		memset(g_scan_lockout, 0, sizeof(g_scan_lockout));
+		g_scan_lockout_freq_count       = 0;
+		g_scan_lockout_count_down_500ms = 0;
+	}
+#endif
@@ -19,6 +19,12 @@
 
 #include "dcs.h"
 #include "driver/keyboard.h"
+#include "misc.h"
+
+#ifdef ENABLE_SCAN_LOCKOUT
+	#define SCAN_LOCKOUT_FREQ_NUM         8
+	#define SCANNER_IS_LOCKED_OUT(ch)     ((g_scan_lockout[(ch) >> 3] >> ((ch) & 7u)) & 1u)
+#endif
 
 enum scan_css_state_e
 {
@@ -59,13 +65,37 @@ extern volatile bool     g_schedule_scan_listen;
 extern volatile uint16_t g_scan_pause_delay_in_10ms;
 extern uint16_t          g_scan_freq_css_timer_10ms;
 extern uint8_t           g_scan_hit_count;
+extern uint16_t          g_scan_freq_lock_10ms;   // time taken to lock onto the carrier
+extern uint16_t          g_scan_css_lock_10ms;    // time taken to decode the CTCSS/CDCSS
 extern bool              g_scan_use_css_result;
 extern scan_state_dir_t  g_scan_state_dir;
 extern bool              g_scan_keep_frequency;
+#ifdef ENABLE_FASTER_CHANNEL_SCAN
+	extern bool          g_scan_dwell_check;
+	extern uint16_t      g_scan_hop_count;
+	extern uint16_t      g_scan_channels_per_sec;
+#endif
+#ifdef ENABLE_SCAN_RANGES
+	extern bool          g_scan_range_active;
+	extern bool          g_scan_range_hold;
+	extern uint32_t      g_scan_range_lower;
+	extern uint32_t      g_scan_range_upper;
+#endif
+#ifdef ENABLE_SCAN_LOCKOUT
+	extern uint8_t       g_scan_lockout[(USER_CHANNEL_LAST + 8) / 8];
+	extern uint32_t      g_scan_lockout_freq[SCAN_LOCKOUT_FREQ_NUM];
+	extern uint8_t       g_scan_lockout_freq_count;
+	extern uint16_t      g_scan_lockout_count_down_500ms;
+#endif
 
 void SCANNER_ProcessKeys(key_code_t Key, bool key_pressed, bool key_held);
 void SCANNER_Start(void);
 void SCANNER_Stop(void);
+#ifdef ENABLE_SCAN_LOCKOUT
+	bool SCANNER_ToggleLockout(void);
+	bool SCANNER_IsFreqLockedOut(const uint32_t Frequency);
+	void SCANNER_ClearLockouts(void);
+#endif
 
 #endif
 
@@ -14,42 +14,46 @@
  *     limitations under the License.
  */
 
-#include "../app/spectrum.h"
+#include <stdlib.h>  // abs()
 
-#define F_MIN FrequencyBandTable[0].lower
-#define F_MAX FrequencyBandTable[ARRAY_SIZE(FrequencyBandTable) - 1].upper
+#include "app/spectrum.h"
 
-const uint16_t RSSI_MAX_VALUE = 65535;
+#define F_MIN FREQ_BAND_TABLE[0].lower
+#define F_MAX FREQ_BAND_TABLE[ARRAY_SIZE(FREQ_BAND_TABLE) - 1].upper
+
+static const uint16_t RSSI_MAX_VALUE = 65535;
 
 static uint32_t initialFreq;
 static char     String[32];
 
-bool isInitialized   = false;
-bool monitorMode     = false;
-bool redrawStatus    = true;
-bool redrawScreen    = false;
-bool newScanStart    = true;
-bool preventKeypress = true;
+static bool isInitialized   = false;
+static bool monitorMode     = false;
+static bool redrawStatus    = true;
+static bool redrawScreen    = false;
+static bool newScanStart    = true;
+static bool preventKeypress = true;
 
-bool isListening     = false;
-bool isTransmitting  = false;
+static bool isListening     = false;
+static bool isTransmitting  = false;
 
-State currentState   = SPECTRUM, previousState = SPECTRUM;
+static State currentState   = SPECTRUM, previousState = SPECTRUM;
 
-PeakInfo      peak;
-ScanInfo      scanInfo;
-KeyboardState kbd    = {KEY_INVALID, KEY_INVALID, 0};
+static PeakInfo      peak;
+static PeakInfo      secondaryPeaks[SECONDARY_PEAKS_NUM];  // f == 0 = unused
+static uint8_t       bgWatchIndex;
+static ScanInfo      scanInfo;
+static KeyboardState kbd    = {KEY_INVALID, KEY_INVALID, 0};
 
-const char   *bwOptions[]               = {"  25k", "12.5k", "6.25k"};
-const char   *modulationTypeOptions[]   = {" FM", " AM", "USB"};
-const uint8_t modulationTypeTuneSteps[] = {100, 50, 10};
-const uint8_t modTypeReg47Values[]      = {1, 7, 5};
+static const char   *bwOptions[]               = {"  25k", "12.5k", "6.25k"};
+static const char   *modulationTypeOptions[]   = {" FM", " AM", "USB"};
+static const uint8_t modulationTypeTuneSteps[] = {100, 50, 10};
+static const uint8_t modTypeReg47Values[]      = {1, 7, 5};
 
-SpectrumSettings settings = {
+static SpectrumSettings settings = {
 	.stepsCount          = STEPS_64,
 	.scanStepIndex       = S_STEP_25_0kHz,
 	.frequencyChangeStep = 80000,
-	.scanDelay           = 3200,
+	.scanDelay           = 1600,
 	.rssiTriggerLevel    = 150,
 	.backlightState      = true,
 	.bw                  = BK4819_FILTER_BW_WIDE,
@@ -57,21 +61,27 @@ SpectrumSettings settings = {
 	.modulationType      = false,
 };
 
-uint32_t fMeasure         = 0;
-uint32_t fTx              = 0;
-uint32_t currentFreq;
-uint32_t tempFreq;
-uint16_t rssiHistory[128] = {0};
-bool     blacklist[128]   = {false};
+static uint32_t fMeasure         = 0;
+static uint32_t fTx              = 0;
+static uint32_t currentFreq;
+static uint32_t tempFreq;
+static uint16_t rssiHistory[128] = {0};
+
+// waterfall ring, 2 bits per pixel column, each sweep scaled to its own noise floor
+static uint8_t  waterfall[WATERFALL_ROWS][128 * WATERFALL_BITS / 8];
+static uint8_t  waterfallHead;         // row the next sweep goes into
+static bool     waterfallNewRow;       // a sweep was added since the last render
+static bool     waterfallRedraw = true;
+static bool     blacklist[128]   = {false};
 
 static const RegisterSpec afOutRegSpec     = {"AF OUT", 0x47, 8, 0xF, 1};
 static const RegisterSpec afDacGainRegSpec = {"AF DAC G", 0x48, 0, 0xF, 1};
 static const RegisterSpec registerSpecs[]  = {
-	{},
-	{"LNAs", 0x13, 8, 0b11,  1},
-	{"LNA",  0x13, 5, 0b111, 1},
-	{"PGA",  0x13, 0, 0b111, 1},
-	{"MIX",  0x13, 3, 0b11,  1},
+	{"",     0,    0, 0,     0},
+	{"LNAs", 0x13, 8, 0x03,  1},
+	{"LNA",  0x13, 5, 0x07, 1},
+	{"PGA",  0x13, 0, 0x07, 1},
+	{"MIX",  0x13, 3, 0x03,  1},
 	{"DEV",  0x40, 0, 4095,  1},
 	{"CMP",  0x31, 3, 1,     1},
 	{"MIC",  0x7D, 0, 0x1F,  1},
@@ -82,24 +92,23 @@ static const uint8_t registersToBackup[] = {
 	0x13, 0x30, 0x31, 0x37, 0x3D, 0x40, 0x43, 0x47, 0x48, 0x7D, 0x7E,
 };
 
-static MovingAverage mov   = {{128}, {}, 255, 128, 0, 0};
+static MovingAverage mov   = {{128}, {{0}}, 255, 128, 0, 0};
 static const uint8_t MOV_N = ARRAY_SIZE(mov.buf);
 
-const uint8_t FREQ_INPUT_LENGTH = 10;
-uint8_t       freqInputIndex    = 0;
-uint8_t       freqInputDotIndex = 0;
-key_code_t    freqInputArr[10];
-char          freqInputString[] = "----------"; // XXXX.XXXXX
+static const uint8_t FREQ_INPUT_LENGTH = 10;
+static uint8_t       freqInputIndex    = 0;
+static uint8_t       freqInputDotIndex = 0;
+static key_code_t    freqInputArr[10];
+static char          freqInputString[] = "----------"; // XXXX.XXXXX
 
-uint8_t  menuState = 0;
+static uint8_t  menuState = 0;
 
-uint16_t listenT   = 0;
+static uint16_t listenT   = 0;
 
-uint16_t batteryUpdateTimer  = 0;
-bool     isMovingInitialized = false;
-uint8_t  lastStepsCount      = 0;
+static uint16_t batteryUpdateTimer  = 0;
+static uint8_t  lastStepsCount      = 0;
 
-uint8_t CountBits(uint16_t n)
+static uint8_t CountBits(uint16_t n)
 {
 	uint8_t count = 0;
 	while (n)
@@ -143,7 +152,7 @@ static void UpdateRegMenuValue(RegisterSpec s, bool add)
 
 // Utility functions
 
-key_code_t GetKey()
+static key_code_t GetKey()
 {
 	key_code_t btn = KEYBOARD_Poll();
 	if (btn == KEY_INVALID && !GPIO_CheckBit(&GPIOC->DATA, GPIOC_PIN_PTT))
@@ -151,7 +160,7 @@ key_code_t GetKey()
 	return btn;
 }
 
-void SetState(State state)
+static void SetState(State state)
 {
 	previousState = currentState;
 	currentState  = state;
@@ -190,9 +199,9 @@ static void SetModulation(ModulationType type)
 	
 	if (type == MOD_USB)
 	{
-		BK4819_WriteRegister(0x37, 0b0001011000001111);
-		BK4819_WriteRegister(0x3D, 0b0010101101000101);
-		BK4819_WriteRegister(0x48, 0b0000001110101000);
+		BK4819_WriteRegister(0x37, 0x160F);
+		BK4819_WriteRegister(0x3D, 0x2B45);
+		BK4819_WriteRegister(0x48, 0x03A8);
 	}
 	
 	if (type == MOD_AM)
@@ -209,6 +218,26 @@ static void SetF(uint32_t f) {
   BK4819_WriteRegister(BK4819_REG_30, reg);
 }
 
+// Sweep retune - the frequency and the REG_30 toggle are all that's needed between
+// steps. The filter path only changes when crossing 280MHz, REG_30 is read once
+// per sweep, and the REG_30 toggle also restarts the RSSI so no separate reset.
+static uint16_t sweepReg30;
+static bool     sweepLowBand;
+
+static void SetSweepF(uint32_t f) {
+  const bool lowBand = f < 28000000;
+
+  fMeasure = f;
+
+  BK4819_SetFrequency(f);
+  if (lowBand != sweepLowBand) {
+    sweepLowBand = lowBand;
+    BK4819_PickRXFilterPathBasedOnFrequency(f);
+  }
+  BK4819_WriteRegister(BK4819_REG_30, 0);
+  BK4819_WriteRegister(BK4819_REG_30, sweepReg30);
+}
+
 static void SetTxF(uint32_t f) {
   fTx = f;
   BK4819_SetFrequency(f);
@@ -220,21 +249,150 @@ static void SetTxF(uint32_t f) {
 
 // Spectrum related
 
-bool IsPeakOverLevel() { return peak.rssi >= settings.rssiTriggerLevel; }
+static bool IsPeakOverLevel() { return peak.rssi >= settings.rssiTriggerLevel; }
 
 static void ResetPeak() {
   peak.t = 0;
   peak.rssi = 0;
 }
 
-bool IsCenterMode() { return settings.scanStepIndex < S_STEP_1_0kHz; }
-uint8_t GetStepsCount() { return 128 >> settings.stepsCount; }
-uint16_t GetScanStep() { return scanStepValues[settings.scanStepIndex]; }
-uint32_t GetBW() { return GetStepsCount() * GetScanStep(); }
-uint32_t GetFStart() {
+static bool IsCenterMode() { return settings.scanStepIndex < S_STEP_1_0kHz; }
+static uint8_t GetStepsCount() { return 128 >> settings.stepsCount; }
+static uint16_t GetScanStep() { return scanStepValues[settings.scanStepIndex]; }
+static uint32_t GetBW() { return GetStepsCount() * GetScanStep(); }
+static uint32_t GetFStart() {
   return IsCenterMode() ? currentFreq - (GetBW() >> 1) : currentFreq;
 }
-uint32_t GetFEnd() { return currentFreq + GetBW(); }
+static uint32_t GetFEnd() { return currentFreq + GetBW(); }
+
+// Settle times measured per filter band and step class, 0 = not measured yet
+static uint16_t settleUs[2][SETTLE_CLASSES];
+static bool     sweepRestart;          // next measurement follows the jump back to the sweep start
+
+static uint16_t CalibrateSettle(uint32_t f, uint32_t jump) {
+  // retune back and forth by the jump and time how long RSSI takes to reach
+  // and stay at its final value
+  uint16_t rssi[64];
+  uint16_t t[64];
+  uint32_t worst = 0;
+
+  for (int n = 0; n < SETTLE_CAL_JUMPS; ++n) {
+    uint8_t count = 0;
+    const uint32_t start = SYSTICK_GetTick();
+
+    SetSweepF((n & 1) ? f : f + jump);
+
+    do {
+      rssi[count] = BK4819_GetRSSI();
+      t[count] = SYSTICK_GetElapsedUs(start);
+    } while (t[count++] < SETTLE_CAL_US && count < ARRAY_SIZE(rssi));
+
+    const uint16_t final = rssi[count - 1];
+    uint8_t i = count - 1;
+    while (i > 0 && abs(rssi[i - 1] - final) <= SETTLE_TOLERANCE) {
+      --i;
+    }
+    if (t[i] > worst) {
+      worst = t[i];
+    }
+  }
+
+  return Clamp(worst + worst / 4, SETTLE_MIN_US, SETTLE_MAX_US);
+}
+
+static uint8_t GetStepClass(uint32_t step) {
+  return (step <= 100) ? 0 : (step <= 1250) ? 1 : (step <= 2500) ? 2 : 3;
+}
+
+static void CalibrateSettleIfNeeded(uint32_t f) {
+  uint16_t *band = settleUs[f < 28000000];
+  const uint8_t c = GetStepClass(GetScanStep());
+  const uint8_t cc = GetStepClass(GetScanStep() * ZOOM_COARSE_DIV);
+
+  if (band[c] == 0) {
+    band[c] = CalibrateSettle(f, GetScanStep());
+  }
+  if (band[cc] == 0) {
+    band[cc] = CalibrateSettle(f, GetScanStep() * ZOOM_COARSE_DIV);
+  }
+  if (band[SETTLE_CLASSES - 1] == 0) {
+    band[SETTLE_CLASSES - 1] = CalibrateSettle(f, GetBW());
+  }
+}
+
+static uint16_t GetSettleUs(uint32_t step) {
+  const uint16_t *band = settleUs[sweepLowBand];
+  const uint16_t us = band[sweepRestart ? SETTLE_CLASSES - 1 : GetStepClass(step)];
+  return us ? us : settings.scanDelay;
+}
+
+// Coarse-to-fine sweeps. Both passes are cached in the bins of the widest
+// (128 bin) span at the current step, so a zoomed view can be drawn from
+// them before anything is measured
+static uint8_t   coarseRssi[ZOOM_COARSE_BINS];
+static uint8_t   fineRssi[128];
+static ZoomCache coarseCache = {0, 0, 0, coarseRssi};
+static ZoomCache fineCache   = {0, 0, 0, fineRssi};
+static uint32_t  coarseHot;            // coarse bins that stood out in the last coarse pass
+static bool      sweepPlanned;
+static bool      sweepFull;
+static uint8_t   sweepsSinceFull;
+
+static uint32_t GetSpanStart() {
+  return IsCenterMode() ? currentFreq - (GetScanStep() << 6) : currentFreq;
+}
+
+static uint8_t GetViewOffset() {
+  return IsCenterMode() ? (128 - GetStepsCount()) >> 1 : 0;
+}
+
+static uint8_t CacheLookup(const ZoomCache *c, uint32_t f) {
+  if (c->count == 0 || f + c->step / 2 < c->fStart) {
+    return 0;
+  }
+  const uint32_t k = (f + c->step / 2 - c->fStart) / c->step;
+  return k < c->count ? c->rssi[k] : 0;
+}
+
+static void ResetZoomCache() {
+  coarseCache.count = 0;
+  fineCache.count = 0;
+  fineCache.step = 0;
+  coarseHot = 0;
+}
+
+static bool SeedView() {
+  // re-key the fine cache to the new span and fill the view from it,
+  // returns true when every bin of the view was known
+  const uint32_t start = GetSpanStart();
+  const uint16_t step = GetScanStep();
+
+  if (fineCache.fStart != start || fineCache.step != step) {
+    uint8_t rekeyed[ARRAY_SIZE(fineRssi)];
+    for (uint8_t k = 0; k < ARRAY_SIZE(fineRssi); ++k) {
+      const uint32_t f = start + (uint32_t)k * step;
+      const uint8_t v = CacheLookup(&fineCache, f);
+      rekeyed[k] = v ? v : CacheLookup(&coarseCache, f);
+    }
+    memcpy(fineRssi, rekeyed, sizeof(fineRssi));
+    fineCache.fStart = start;
+    fineCache.step = step;
+    fineCache.count = ARRAY_SIZE(fineRssi);
+  }
+
+  bool seeded = true;
+  const uint8_t off = GetViewOffset();
+  for (uint8_t i = 0; i < GetStepsCount(); ++i) {
+    rssiHistory[i] = fineRssi[off + i] << 1;
+    seeded &= fineRssi[off + i] != 0;
+  }
+  return seeded;
+}
+
+static void StoreRssi(uint8_t i, uint16_t rssi) {
+  rssiHistory[i] = rssi;
+  fineRssi[GetViewOffset() + i] = rssi >> 1;
+}
 
 static void MovingCp(uint16_t *dst, uint16_t *src) {
   memcpy(dst, src, GetStepsCount() * sizeof(uint16_t));
@@ -301,12 +459,12 @@ static void TuneToPeak() {
   SetF(scanInfo.f);
 }
 
-uint8_t GetBWRegValueForScan() {
+static uint8_t GetBWRegValueForScan() {
   return scanStepBWRegValues[settings.scanStepIndex == S_STEP_100_0kHz ? 11
                                                                        : 0];
 }
 
-uint8_t GetBWRegValueForListen() {
+static uint8_t GetBWRegValueForListen() {
   return listenBWRegValues[settings.listenBw];
 }
 
@@ -318,31 +476,30 @@ static void ResetRSSI() {
   BK4819_WriteRegister(BK4819_REG_30, Reg);
 }
 
-uint16_t GetRssi() {
+static uint16_t GetRssi() {
   if (currentState == SPECTRUM) {
     ResetRSSI();
-    SYSTICK_DelayUs(3200);
+    SYSTICK_DelayUs(settings.scanDelay);
   }
   return BK4819_GetRSSI();
 }
 
-uint32_t GetOffsetedF(uint32_t f) {
-  switch (gCurrentVfo->FREQUENCY_DEVIATION_SETTING) {
-  case FREQUENCY_DEVIATION_OFF:
+static uint32_t GetOffsetedF(uint32_t f) {
+  switch (g_tx_vfo->tx_offset_freq_dir) {
+  case TX_OFFSET_FREQ_DIR_OFF:
     break;
-  case FREQUENCY_DEVIATION_ADD:
-    f += gCurrentVfo->FREQUENCY_OF_DEVIATION;
+  case TX_OFFSET_FREQ_DIR_ADD:
+    f += g_tx_vfo->tx_offset_freq;
     break;
-  case FREQUENCY_DEVIATION_SUB:
-    f -= gCurrentVfo->FREQUENCY_OF_DEVIATION;
+  case TX_OFFSET_FREQ_DIR_SUB:
+    f -= g_tx_vfo->tx_offset_freq;
     break;
   }
 
-  return Clamp(f, FrequencyBandTable[0].lower,
-               FrequencyBandTable[ARRAY_SIZE(FrequencyBandTable) - 1].upper);
+  return Clamp(f, F_MIN, F_MAX);
 }
 
-bool IsTXAllowed() { return g_setting_ALL_TX != 2; }
+static bool IsTXAllowed() { return g_setting_tx_enable; }
 
 static void ToggleAudio(bool on) {
   if (on) {
@@ -379,7 +536,7 @@ static void ToggleRX(bool on) {
   }
 }
 
-uint16_t registersVault[128] = {0};
+static uint16_t registersVault[128] = {0};
 
 static void RegBackupSet(uint8_t num, uint16_t value) {
   registersVault[num] = BK4819_ReadRegister(num);
@@ -415,8 +572,8 @@ static void ToggleTX(bool on) {
     BK4819_WriteRegister(BK4819_REG_30, 0xC1FE);
     RegBackupSet(BK4819_REG_51, 0x0000);
 
-    BK4819_SetupPowerAmplifier(gCurrentVfo->TXP_CalculatedSetting,
-                               gCurrentVfo->pTX->Frequency);
+    BK4819_SetupPowerAmplifier(g_tx_vfo->txp_calculated_setting,
+                               g_tx_vfo->pTX->frequency);
   } else {
     RADIO_SendEndOfTransmission();
     RADIO_EnableCxCSS();
@@ -454,6 +611,14 @@ static void InitScan() {
 
   scanInfo.scanStep = GetScanStep();
   scanInfo.measurementsCount = GetStepsCount();
+
+  sweepReg30 = BK4819_ReadRegister(BK4819_REG_30);
+  sweepLowBand = scanInfo.f < 28000000;
+  BK4819_PickRXFilterPathBasedOnFrequency(scanInfo.f);
+
+  CalibrateSettleIfNeeded(scanInfo.f);
+  sweepRestart = true;
+  sweepPlanned = false;
 }
 
 static void ResetBlacklist() {
@@ -466,7 +631,11 @@ static void ResetBlacklist() {
 static void RelaunchScan() {
   InitScan();
   ResetPeak();
+  memset(secondaryPeaks, 0, sizeof(secondaryPeaks));
   lastStepsCount = 0;
+  if (SeedView()) {
+    MoveHistory();
+  }
   ToggleRX(false);
 #ifdef SPECTRUM_AUTOMATIC_SQUELCH
   settings.rssiTriggerLevel = RSSI_MAX_VALUE;
@@ -646,7 +815,7 @@ static void ToggleStepsCount() {
 
 static void ResetFreqInput() {
   tempFreq = 0;
-  for (int i = 0; i < 10; ++i) {
+  for (int i = 0; i < FREQ_INPUT_LENGTH; ++i) {
     freqInputString[i] = '-';
   }
 }
@@ -659,7 +828,7 @@ static void FreqInput() {
 }
 
 static void UpdateFreqInput(key_code_t key) {
-  if (key != KEY_EXIT && freqInputIndex >= 10) {
+  if (key != KEY_EXIT && freqInputIndex >= FREQ_INPUT_LENGTH) {
     return;
   }
   if (key == KEY_STAR) {
@@ -680,7 +849,7 @@ static void UpdateFreqInput(key_code_t key) {
       freqInputDotIndex == 0 ? freqInputIndex : freqInputDotIndex;
 
   key_code_t digitKey;
-  for (int i = 0; i < 10; ++i) {
+  for (int i = 0; i < FREQ_INPUT_LENGTH; ++i) {
     if (i < freqInputIndex) {
       digitKey = freqInputArr[i];
       freqInputString[i] = digitKey <= KEY_9 ? '0' + digitKey : '.';
@@ -714,10 +883,14 @@ static void Blacklist() {
 
 // Draw things
 
+static uint8_t GetDrawingEndY() {
+  return settings.waterfall ? WaterfallDrawingEndY : DrawingEndY;
+}
+
 static uint8_t Rssi2Y(uint16_t rssi) {
-  return DrawingEndY - ConvertDomain(rssi, mov.min - 2,
+  return GetDrawingEndY() - ConvertDomain(rssi, mov.min - 2,
                                      mov.max + 30 + (mov.max - mov.min) / 3, 0,
-                                     DrawingEndY);
+                                     GetDrawingEndY());
 }
 
 static void DrawSpectrum() {
@@ -727,7 +900,69 @@ static void DrawSpectrum() {
       continue;
     }
     uint16_t rssi = rssiHistory[i];
-    DrawHLine(Rssi2Y(rssi), DrawingEndY, x, true);
+    UI_DrawVLine(Rssi2Y(rssi), GetDrawingEndY(), x, true);
+  }
+}
+
+static void AddWaterfallRow() {
+  const uint8_t XN = GetStepsCount();
+  uint8_t *row = waterfall[waterfallHead];
+  uint16_t min = RSSI_MAX_VALUE;
+  uint16_t max = 0;
+
+  for (int i = 0; i < XN; ++i) {
+    if (blacklist[i]) {
+      continue;
+    }
+    if (rssiHistory[i] < min) {
+      min = rssiHistory[i];
+    }
+    if (rssiHistory[i] > max) {
+      max = rssiHistory[i];
+    }
+  }
+
+  // quarter of this sweeps range per level, but never finer than 3dB so
+  // the noise floor stays dark
+  uint16_t step = (max > min) ? (max - min + 3) / 4 : 1;
+  if (step < 6) {
+    step = 6;
+  }
+
+  memset(row, 0, sizeof(waterfall[0]));
+  for (uint8_t x = 0; x < 128; ++x) {
+    const uint8_t i = x >> settings.stepsCount;
+    if (blacklist[i] || rssiHistory[i] < min) {
+      continue;
+    }
+    uint16_t level = (rssiHistory[i] - min) / step;
+    if (level > 3) {
+      level = 3;
+    }
+    row[x >> 2] |= level << ((x & 3) * WATERFALL_BITS);
+  }
+
+  if (++waterfallHead >= WATERFALL_ROWS) {
+    waterfallHead = 0;
+  }
+  waterfallNewRow = true;
+}
+
+static void DrawWaterfallRow(uint8_t r) {
+  // 2x2 ordered dither turns the 2 bit level into pixel density
+  static const uint8_t bayer[4] = {0, 2, 3, 1};
+  const uint8_t y = WaterfallTopY + r;
+  const uint8_t *row = waterfall[r];
+
+  for (uint8_t x = 0; x < 128; ++x) {
+    const uint8_t level = (row[x >> 2] >> ((x & 3) * WATERFALL_BITS)) & 3;
+    UI_DrawPixel(x, y, level == 3 || level > bayer[((y & 1) << 1) | (x & 1)]);
+  }
+}
+
+static void DrawWaterfall() {
+  for (uint8_t r = 0; r < WATERFALL_ROWS; ++r) {
+    DrawWaterfallRow(r);
   }
 }
 
@@ -749,19 +984,19 @@ static void UpdateBatteryInfo() {
 
 static void DrawStatus() {
 
-  g_status_line[127] = 0b01111110;
+  g_status_line[127] = 0x7E;
   for (int i = 126; i >= 116; i--) {
-    g_status_line[i] = 0b01000010;
+    g_status_line[i] = 0x42;
   }
   uint8_t v = g_battery_display_level;
   v <<= 1;
   for (int i = 125; i >= 116; i--) {
     if (126 - i <= v) {
-      g_status_line[i + 2] = 0b01111110;
+      g_status_line[i + 2] = 0x7E;
     }
   }
-  g_status_line[117] = 0b01111110;
-  g_status_line[116] = 0b00011000;
+  g_status_line[117] = 0x7E;
+  g_status_line[116] = 0x18;
 }
 
 static void DrawF(uint32_t f) {
@@ -780,34 +1015,34 @@ static void DrawF(uint32_t f) {
   UI_PrintStringSmall(String, 8, 127, 0);
 
   sprintf(String, "%s", modulationTypeOptions[settings.modulationType]);
-  UI_PrintStringSmallest(String, 116, 1, false, true);
+  UI_PrintStringSmallest(String, 116, 1, true);
   sprintf(String, "%s", bwOptions[settings.listenBw]);
-  UI_PrintStringSmallest(String, 108, 7, false, true);
+  UI_PrintStringSmallest(String, 108, 7, true);
 }
 
 static void DrawNums() {
   if (currentState == SPECTRUM) {
     sprintf(String, "%ux", GetStepsCount());
-    UI_PrintStringSmallest(String, 0, 1, false, true);
+    UI_PrintStringSmallest(String, 0, 1, true);
     sprintf(String, "%u.%02uk", GetScanStep() / 100, GetScanStep() % 100);
-    UI_PrintStringSmallest(String, 0, 7, false, true);
+    UI_PrintStringSmallest(String, 0, 7, true);
   }
 
   if (IsCenterMode()) {
     sprintf(String, "%u.%05u \xB1%u.%02uk", currentFreq / 100000,
             currentFreq % 100000, settings.frequencyChangeStep / 100,
             settings.frequencyChangeStep % 100);
-    UI_PrintStringSmallest(String, 36, 49, false, true);
+    UI_PrintStringSmallest(String, 36, 49, true);
   } else {
     sprintf(String, "%u.%05u", GetFStart() / 100000, GetFStart() % 100000);
-    UI_PrintStringSmallest(String, 0, 49, false, true);
+    UI_PrintStringSmallest(String, 0, 49, true);
 
     sprintf(String, "\xB1%u.%02uk", settings.frequencyChangeStep / 100,
             settings.frequencyChangeStep % 100);
-    UI_PrintStringSmallest(String, 48, 49, false, true);
+    UI_PrintStringSmallest(String, 48, 49, true);
 
     sprintf(String, "%u.%05u", GetFEnd() / 100000, GetFEnd() % 100000);
-    UI_PrintStringSmallest(String, 93, 49, false, true);
+    UI_PrintStringSmallest(String, 93, 49, true);
   }
 }
 
@@ -816,7 +1051,7 @@ static void DrawRssiTriggerLevel() {
     return;
   uint8_t y = Rssi2Y(settings.rssiTriggerLevel);
   for (uint8_t x = 0; x < 128; x += 2) {
-    PutPixel(x, y, true);
+    UI_DrawPixel(x, y, true);
   }
 }
 
@@ -824,12 +1059,12 @@ static void DrawTicks() {
   uint32_t f = GetFStart() % 100000;
   uint32_t step = GetScanStep();
   for (uint8_t i = 0; i < 128; i += (1 << settings.stepsCount), f += step) {
-    uint8_t barValue = 0b00000001;
-    (f % 10000) < step && (barValue |= 0b00000010);
-    (f % 50000) < step && (barValue |= 0b00000100);
-    (f % 100000) < step && (barValue |= 0b00011000);
+    uint8_t barValue = 0x01;
+    (f % 10000) < step && (barValue |= 0x02);
+    (f % 50000) < step && (barValue |= 0x04);
+    (f % 100000) < step && (barValue |= 0x18);
 
-    g_frame_buffer[5][i] |= barValue;
+    g_frame_buffer[GetDrawingEndY() >> 3][i] |= barValue;
   }
 
   // center
@@ -856,7 +1091,111 @@ static void DrawArrow(uint8_t x) {
     signed v = x + i;
     uint8_t a = i > 0 ? i : -i;
     if (!(v & 128)) {
-      g_frame_buffer[5][v] |= (0b01111000 << a) & 0b01111000;
+      g_frame_buffer[GetDrawingEndY() >> 3][v] |= (0x78 << a) & 0x78;
+    }
+  }
+}
+
+static void AddSecondaryPeak(uint8_t i, uint32_t f, uint16_t rssi) {
+  // same frequency is refreshed, otherwise an empty or the oldest slot is used
+  uint8_t slot = 0;
+  for (uint8_t n = 0; n < SECONDARY_PEAKS_NUM; ++n) {
+    if (secondaryPeaks[n].f == f) {
+      slot = n;
+      break;
+    }
+    if (secondaryPeaks[slot].f != 0 &&
+        (secondaryPeaks[n].f == 0 || secondaryPeaks[n].t > secondaryPeaks[slot].t)) {
+      slot = n;
+    }
+  }
+  secondaryPeaks[slot].f = f;
+  secondaryPeaks[slot].i = i;
+  secondaryPeaks[slot].rssi = rssi;
+  secondaryPeaks[slot].t = 0;
+}
+
+static void AgeSecondaryPeaks() {
+  for (uint8_t n = 0; n < SECONDARY_PEAKS_NUM; ++n) {
+    if (secondaryPeaks[n].f != 0 && ++secondaryPeaks[n].t > SECONDARY_PEAK_MAX_AGE) {
+      secondaryPeaks[n].f = 0;
+    }
+  }
+}
+
+static bool JumpToSecondaryPeak() {
+  // listen to the strongest secondary peak, the current one takes its place on the list
+  uint8_t best = SECONDARY_PEAKS_NUM;
+  for (uint8_t n = 0; n < SECONDARY_PEAKS_NUM; ++n) {
+    if (secondaryPeaks[n].f != 0 &&
+        (best == SECONDARY_PEAKS_NUM || secondaryPeaks[n].rssi > secondaryPeaks[best].rssi)) {
+      best = n;
+    }
+  }
+  if (best == SECONDARY_PEAKS_NUM) {
+    return false;
+  }
+
+  const PeakInfo next = secondaryPeaks[best];
+  secondaryPeaks[best] = peak;
+  secondaryPeaks[best].t = 0;
+  peak = next;
+
+  TuneToPeak();
+  listenT = 1000;
+  redrawScreen = true;
+  return true;
+}
+
+static void BackgroundWatch() {
+  // only in the gaps, the signal being listened to is left alone while it's there
+  if (BK4819_GetRSSI() >= settings.rssiTriggerLevel) {
+    return;
+  }
+
+  ToggleAudio(false);
+  BK4819_WriteRegister(0x43, GetBWRegValueForScan());
+  sweepReg30 = BK4819_ReadRegister(BK4819_REG_30);
+  sweepRestart = true;
+
+  for (uint8_t n = 0; n < BG_WATCH_BINS; ++n) {
+    if (++bgWatchIndex >= scanInfo.measurementsCount) {
+      bgWatchIndex = 0;
+    }
+    if (bgWatchIndex == peak.i || blacklist[bgWatchIndex]) {
+      continue;
+    }
+
+    const uint32_t f = GetFStart() + (uint32_t)bgWatchIndex * scanInfo.scanStep;
+    SetSweepF(f);
+    SYSTICK_DelayUs(GetSettleUs(scanInfo.scanStep));
+    sweepRestart = false;
+
+    const uint16_t rssi = BK4819_GetRSSI();
+    StoreRssi(bgWatchIndex, rssi);
+    if (rssi >= settings.rssiTriggerLevel) {
+      AddSecondaryPeak(bgWatchIndex, f, rssi);
+    }
+  }
+  AgeSecondaryPeaks();
+
+  // back to the signal
+  SetF(scanInfo.f);
+  BK4819_WriteRegister(0x43, GetBWRegValueForListen());
+  ToggleAudio(true);
+  redrawScreen = true;
+}
+
+static void DrawSecondaryPeaks() {
+  for (uint8_t n = 0; n < SECONDARY_PEAKS_NUM; ++n) {
+    if (secondaryPeaks[n].f == 0) {
+      continue;
+    }
+    const signed x = secondaryPeaks[n].i << settings.stepsCount;
+    for (signed v = x - 1; v <= x + 1; ++v) {
+      if (v >= 0 && v < 128) {
+        g_frame_buffer[GetDrawingEndY() >> 3][v] |= 0x80;
+      }
     }
   }
 }
@@ -924,6 +1263,12 @@ static void OnKeyDown(uint8_t key) {
     settings.rssiTriggerLevel = 120;
     break;
   case KEY_MENU:
+    if (isListening && JumpToSecondaryPeak()) {
+      break;
+    }
+    settings.waterfall = !settings.waterfall;
+    waterfallRedraw = true;
+    redrawScreen = true;
     break;
   case KEY_EXIT:
     if (menuState) {
@@ -977,7 +1322,7 @@ static void OnKeyDownFreqInput(uint8_t key) {
   }
 }
 
-void OnKeyDownStill(key_code_t key) {
+static void OnKeyDownStill(key_code_t key) {
   switch (key) {
   case KEY_3:
     break;
@@ -1055,7 +1400,7 @@ static void OnKeysReleased() {
 }
 
 static void RenderFreqInput() {
-  UI_PrintString(freqInputString, 2, 127, 0, 8, true);
+  UI_PrintString(freqInputString, 2, 127, 0, 8);
 }
 
 static void RenderStatus() {
@@ -1067,6 +1412,7 @@ static void RenderStatus() {
 static void RenderSpectrum() {
   DrawTicks();
   DrawArrow(peak.i << settings.stepsCount);
+  DrawSecondaryPeaks();
   DrawSpectrum();
   DrawRssiTriggerLevel();
   DrawF(peak.f);
@@ -1080,16 +1426,16 @@ static void RenderStill() {
 
   for (int i = 0; i < 121; i++) {
     if (i % 10 == 0) {
-      g_frame_buffer[2][i + METER_PAD_LEFT] = 0b11000000;
+      g_frame_buffer[2][i + METER_PAD_LEFT] = 0xC0;
     } else {
-      g_frame_buffer[2][i + METER_PAD_LEFT] = 0b01000000;
+      g_frame_buffer[2][i + METER_PAD_LEFT] = 0x40;
     }
   }
 
   uint8_t x = Rssi2PX(scanInfo.rssi, 0, 121);
   for (int i = 0; i < x; ++i) {
     if (i % 5 && i / 5 < x / 5) {
-      g_frame_buffer[2][i + METER_PAD_LEFT] |= 0b00011100;
+      g_frame_buffer[2][i + METER_PAD_LEFT] |= 0x1C;
     }
   }
 
@@ -1100,23 +1446,23 @@ static void RenderStill() {
   } else {
     sprintf(String, "S9+%u0", s - 9);
   }
-  UI_PrintStringSmallest(String, 4, 10, false, true);
+  UI_PrintStringSmallest(String, 4, 10, true);
   sprintf(String, "%d dBm", dbm);
-  UI_PrintStringSmallest(String, 32, 10, false, true);
+  UI_PrintStringSmallest(String, 32, 10, true);
 
   if (isTransmitting) {
-    uint8_t afDB = BK4819_ReadRegister(0x6F) & 0b1111111;
+    uint8_t afDB = BK4819_ReadRegister(0x6F) & 0x7F;
     uint8_t afPX = ConvertDomain(afDB, 26, 194, 0, 121);
     for (int i = 0; i < afPX; ++i) {
-      g_frame_buffer[3][i + METER_PAD_LEFT] |= 0b00000011;
+      g_frame_buffer[3][i + METER_PAD_LEFT] |= 0x03;
     }
   }
 
   if (!monitorMode) {
     uint8_t x = Rssi2PX(settings.rssiTriggerLevel, 0, 121);
-    g_frame_buffer[2][METER_PAD_LEFT + x - 1] |= 0b01000001;
-    g_frame_buffer[2][METER_PAD_LEFT + x] = 0b01111111;
-    g_frame_buffer[2][METER_PAD_LEFT + x + 1] |= 0b01000001;
+    g_frame_buffer[2][METER_PAD_LEFT + x - 1] |= 0x41;
+    g_frame_buffer[2][METER_PAD_LEFT + x] = 0x7F;
+    g_frame_buffer[2][METER_PAD_LEFT + x + 1] |= 0x41;
   }
 
   const uint8_t PAD_LEFT = 4;
@@ -1138,15 +1484,51 @@ static void RenderStill() {
     }
     RegisterSpec s = registerSpecs[idx];
     sprintf(String, "%s", s.name);
-    UI_PrintStringSmallest(String, offset + 2, row * 8 + 2, false,
+    UI_PrintStringSmallest(String, offset + 2, row * 8 + 2,
                            menuState != idx);
     sprintf(String, "%u", GetRegValue(s));
-    UI_PrintStringSmallest(String, offset + 2, (row + 1) * 8 + 1, false,
+    UI_PrintStringSmallest(String, offset + 2, (row + 1) * 8 + 1,
                            menuState != idx);
   }
 }
 
+static void RenderWaterfall() {
+  // the waterfall pages are kept between renders, only the live trace pages
+  // and the newest waterfall row are redrawn so the SPI traffic stays constant
+  const uint8_t wfPage = WaterfallTopY >> 3;
+  const uint8_t newest = waterfallHead ? waterfallHead - 1 : WATERFALL_ROWS - 1;
+
+  memset(g_frame_buffer, 0, wfPage * sizeof(g_frame_buffer[0]));
+  memset(g_frame_buffer[6], 0, sizeof(g_frame_buffer[6]));
+  RenderSpectrum();
+
+  if (waterfallRedraw) {
+    DrawWaterfall();
+    ST7565_BlitFullScreen();
+    waterfallRedraw = false;
+    waterfallNewRow = false;
+    return;
+  }
+
+  for (uint8_t page = 0; page < wfPage; ++page) {
+    ST7565_DrawLine(0, page + 1, 128, g_frame_buffer[page]);
+  }
+  if (waterfallNewRow) {
+    const uint8_t page = (WaterfallTopY + newest) >> 3;
+    DrawWaterfallRow(newest);
+    ST7565_DrawLine(0, page + 1, 128, g_frame_buffer[page]);
+    waterfallNewRow = false;
+  }
+  ST7565_DrawLine(0, 6 + 1, 128, g_frame_buffer[6]);
+}
+
 static void Render() {
+  if (currentState == SPECTRUM && settings.waterfall) {
+    RenderWaterfall();
+    return;
+  }
+  waterfallRedraw = true;
+
   memset(g_frame_buffer, 0, sizeof(g_frame_buffer));
 
   switch (currentState) {
@@ -1164,7 +1546,7 @@ static void Render() {
   ST7565_BlitFullScreen();
 }
 
-bool HandleUserInput() {
+static bool HandleUserInput() {
   kbd.prev = kbd.current;
   kbd.current = GetKey();
 
@@ -1196,12 +1578,76 @@ bool HandleUserInput() {
   return true;
 }
 
+static void CoarseSweep() {
+  // wide filter every 4th bin, the noise floor difference between the
+  // filters is taken out before comparing against the trigger level
+  const uint32_t step = scanInfo.scanStep * ZOOM_COARSE_DIV;
+  const uint32_t start = GetSpanStart() + scanInfo.scanStep * (ZOOM_COARSE_DIV / 2);
+  uint16_t rssi[ZOOM_COARSE_BINS];
+  uint16_t floor = RSSI_MAX_VALUE;
+
+  BK4819_WriteRegister(0x43, scanStepBWRegValues[S_STEP_100_0kHz]);
+  for (uint8_t c = 0; c < ZOOM_COARSE_BINS; ++c) {
+    SetSweepF(start + c * step);
+    SYSTICK_DelayUs(GetSettleUs(step));
+    sweepRestart = false;
+    rssi[c] = BK4819_GetRSSI();
+    coarseRssi[c] = rssi[c] >> 1;
+    if (rssi[c] < floor) {
+      floor = rssi[c];
+    }
+  }
+  BK4819_WriteRegister(0x43, GetBWRegValueForScan());
+  sweepRestart = true;
+
+  coarseCache.fStart = start;
+  coarseCache.step = step;
+  coarseCache.count = ZOOM_COARSE_BINS;
+
+  const int32_t level = (int32_t)settings.rssiTriggerLevel + floor - mov.min;
+  coarseHot = 0;
+  for (uint8_t c = 0; c < ZOOM_COARSE_BINS; ++c) {
+    if (rssi[c] >= level) {
+      coarseHot |= 1u << c;
+    }
+  }
+}
+
+static void PlanSweep() {
+  sweepFull = GetStepsCount() < ZOOM_MIN_BINS ||
+              settings.rssiTriggerLevel == RSSI_MAX_VALUE ||
+              ++sweepsSinceFull >= ZOOM_FULL_EVERY;
+  if (sweepFull) {
+    sweepsSinceFull = 0;
+    return;
+  }
+  CoarseSweep();
+}
+
+static bool IsBinPlanned(uint8_t i) {
+  // a bin gets the fine sweep when its coarse bin or either neighbour stood out
+  const uint8_t k = GetViewOffset() + i;
+  const uint8_t c = k / ZOOM_COARSE_DIV;
+  const uint32_t near = c ? (coarseHot >> (c - 1)) & 7 : coarseHot & 3;
+  return sweepFull || fineRssi[k] == 0 || near;
+}
+
 static void Scan() {
   if (blacklist[scanInfo.i]) {
     return;
   }
-  SetF(scanInfo.f);
-  Measure();
+  if (!IsBinPlanned(scanInfo.i)) {
+    // quiet part of the span, the cached value stands
+    scanInfo.rssi = rssiHistory[scanInfo.i];
+    UpdateScanInfo();
+    sweepRestart = true;
+    return;
+  }
+  SetSweepF(scanInfo.f);
+  SYSTICK_DelayUs(GetSettleUs(scanInfo.scanStep));
+  sweepRestart = false;
+  scanInfo.rssi = BK4819_GetRSSI();
+  StoreRssi(scanInfo.i, scanInfo.rssi);
   UpdateScanInfo();
 }
 
@@ -1212,14 +1658,20 @@ static void NextScanStep() {
 }
 
 static void UpdateScan() {
-  Scan();
+  if (!sweepPlanned) {
+    PlanSweep();
+    sweepPlanned = true;
+  }
 
+  // i == measurementsCount is one past the last bin, nothing to measure there
   if (scanInfo.i < scanInfo.measurementsCount) {
+    Scan();
     NextScanStep();
     return;
   }
 
   MoveHistory();
+  AddWaterfallRow();
 
   redrawScreen = true;
   preventKeypress = false;
@@ -1255,6 +1707,9 @@ static void UpdateListening() {
   }
   if (listenT) {
     listenT--;
+    if (currentState == SPECTRUM && listenT % BG_WATCH_INTERVAL_MS == 0) {
+      BackgroundWatch();
+    }
     SYSTEM_DelayMs(1);
     return;
   }
@@ -1327,14 +1782,14 @@ static void AutomaticPresetChoose(uint32_t f) {
 void APP_RunSpectrum() {
   BackupRegisters();
   // TX here coz it always? set to active VFO
-  VFO_Info_t vfo = g_eeprom.vfo_info[g_eeprom.TX_CHANNEL];
-  initialFreq = vfo.pRX->Frequency;
+  const vfo_info_t *vfo = &g_eeprom.vfo_info[g_eeprom.tx_vfo];
+  initialFreq = vfo->pRX->frequency;
   currentFreq = initialFreq;
-  settings.scanStepIndex = gStepSettingToIndex[vfo.STEP_SETTING];
-  settings.listenBw = vfo.CHANNEL_BANDWIDTH == BANDWIDTH_WIDE
-                          ? BANDWIDTH_WIDE
-                          : BANDWIDTH_NARROW;
-  settings.modulationType = vfo.IsAM ? MOD_AM : MOD_FM;
+  settings.scanStepIndex = gStepSettingToIndex[vfo->step_setting];
+  settings.listenBw = vfo->channel_bandwidth == BANDWIDTH_WIDE
+                          ? BK4819_FILTER_BW_WIDE
+                          : BK4819_FILTER_BW_NARROW;
+  settings.modulationType = vfo->am_mode ? MOD_AM : MOD_FM;
 
   AutomaticPresetChoose(currentFreq);
 
@@ -1345,6 +1800,7 @@ void APP_RunSpectrum() {
   ToggleRX(true), ToggleRX(false); // hack to prevent noise when squelch off
   SetModulation(settings.modulationType);
 
+  ResetZoomCache();
   RelaunchScan();
 
   for (int i = 0; i < 128; ++i) {
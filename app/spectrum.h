@@ -21,71 +21,100 @@
 #include <stdint.h>
 #include <string.h>
 
-#include "../bitmaps.h"
-#include "../board.h"
-#include "../bsp/dp32g030/gpio.h"
-#include "../driver/bk4819-regs.h"
-#include "../driver/bk4819.h"
-#include "../driver/gpio.h"
-#include "../driver/keyboard.h"
-#include "../driver/st7565.h"
-#include "../driver/system.h"
-#include "../driver/systick.h"
-#include "../external/printf/printf.h"
-#include "../font.h"
-#include "../frequencies.h"
-#include "../helper/battery.h"
-#include "../helper/measurements.h"
-#include "../misc.h"
-#include "../radio.h"
-#include "../settings.h"
-#include "../ui/helper.h"
-
-static const uint8_t DrawingEndY = 40;
+#include "bitmaps.h"
+#include "board.h"
+#include "bsp/dp32g030/gpio.h"
+#include "driver/bk4819-regs.h"
+#include "driver/bk4819.h"
+#include "driver/gpio.h"
+#include "driver/keyboard.h"
+#include "driver/st7565.h"
+#include "driver/system.h"
+#include "driver/systick.h"
+#include "external/printf/printf.h"
+#include "font.h"
+#include "frequencies.h"
+#include "helper/battery.h"
+#include "helper/measurements.h"
+#include "misc.h"
+#include "radio.h"
+#include "settings.h"
+#include "ui/helper.h"
+
+static const uint8_t DrawingEndY          = 40;
+static const uint8_t WaterfallDrawingEndY = 24;   // live trace is shortened to make room for the waterfall
+static const uint8_t WaterfallTopY        = 32;   // waterfall rows sit between the ticks and the numbers
+
+#define WATERFALL_ROWS  16                        // sweeps kept, one pixel row each
+#define WATERFALL_BITS  2                         // intensity bits per bin
+
+// RSSI settle time calibration
+#define SETTLE_CLASSES      5      // step <= 1kHz, <= 12.5kHz, 25kHz, 100kHz, sweep restart jump
+#define SETTLE_CAL_JUMPS    4      // retunes timed per class, the slowest one is used
+#define SETTLE_CAL_US       6400   // how long RSSI is watched after each retune
+#define SETTLE_TOLERANCE    3      // 1.5dB .. RSSI counts as settled once it stays this close to its final value
+#define SETTLE_MIN_US       400
+#define SETTLE_MAX_US       6400
+
+// background watch of the rest of the span while listening to a peak
+#define SECONDARY_PEAKS_NUM     4
+#define BG_WATCH_INTERVAL_MS    50     // how often a gap in the signal is looked for
+#define BG_WATCH_BINS           4      // bins measured per gap
+#define SECONDARY_PEAK_MAX_AGE  600    // in background watch passes, 30s at most
+
+// coarse-to-fine sweeps and the zoom cache
+#define ZOOM_COARSE_DIV     4      // fine bins per coarse bin
+#define ZOOM_COARSE_BINS    (128 / ZOOM_COARSE_DIV)
+#define ZOOM_FULL_EVERY     8      // every 8th sweep measures every bin anyway
+#define ZOOM_MIN_BINS       64     // narrower views are always swept in full
 
 static const uint16_t scanStepValues[] = {
 	1,   10,  50,  100, 250, 500, 625, 833, 1000, 1250, 2500, 10000,
 };
 
 static const uint8_t gStepSettingToIndex[] = {
-	[STEP_2_5kHz]  = 4,  [STEP_5_0kHz] = 5, [STEP_6_25kHz] = 6,
-	[STEP_10_0kHz] = 8, [STEP_12_5kHz] = 9, [STEP_25_0kHz] = 10,
-	[STEP_8_33kHz] = 7,
+	#ifdef ENABLE_1250HZ_STEP
+		[STEP_1_25kHz] = 3,
+	#else
+		[STEP_5_0kHz]  = 5,
+	#endif
+	[STEP_2_5kHz]  = 4, [STEP_6_25kHz] = 6, [STEP_10_0kHz] = 8,
+	[STEP_12_5kHz] = 9, [STEP_25_0kHz] = 10, [STEP_8_33kHz] = 7,
 };
 
 static const uint16_t scanStepBWRegValues[12] = {
 	//     RX  RXw TX  BW
 	// 0b0 000 000 001 01 1000
 	// 1
-	0b0000000001011000, // 6.25
+	0x0058, // 6.25
 	// 10
-	0b0000000001011000, // 6.25
+	0x0058, // 6.25
 	// 50
-	0b0000000001011000, // 6.25
+	0x0058, // 6.25
 	// 100
-	0b0000000001011000, // 6.25
+	0x0058, // 6.25
 	// 250
-	0b0000000001011000, // 6.25
+	0x0058, // 6.25
 	// 500
-	0b0010010001011000, // 6.25
+	0x2458, // 6.25
 	// 625
-	0b0100100001011000, // 6.25
+	0x4858, // 6.25
 	// 833
-	0b0110110001001000, // 6.25
+	0x6C48, // 6.25
 	// 1000
-	0b0110110001001000, // 6.25
+	0x6C48, // 6.25
 	// 1250
-	0b0111111100001000, // 6.25
+	0x7F08, // 6.25
 	// 2500
-	0b0011011000101000, // 25
+	0x3628, // 25
 	// 10000
-	0b0011011000101000, // 25
+	0x3628, // 25
 };
 
 static const uint16_t listenBWRegValues[] = {
-	0b0011011000101000, // 25
-	0b0111111100001000, // 12.5
-	0b0100100001011000, // 6.25
+	0x3628, // 25
+	0x7F08, // 12.5
+	0x4858, // 6.25
 };
 
 typedef enum State {
@@ -131,14 +160,15 @@ typedef struct SpectrumSettings {
 	uint16_t rssiTriggerLevel;
 
 	bool backlightState;
-	BK4819_FilterBandwidth_t bw;
-	BK4819_FilterBandwidth_t listenBw;
+	bool waterfall;
+	BK4819_filter_bandwidth_t bw;
+	BK4819_filter_bandwidth_t listenBw;
 	ModulationType modulationType;
 } SpectrumSettings;
 
 typedef struct KeyboardState {
-	KEY_Code_t current;
-	KEY_Code_t prev;
+	key_code_t current;
+	key_code_t prev;
 	uint8_t counter;
 } KeyboardState;
 
@@ -165,6 +195,13 @@ typedef struct PeakInfo {
 	uint32_t f;
 } PeakInfo;
 
+typedef struct ZoomCache {
+	uint32_t fStart;
+	uint32_t step;
+	uint8_t count;
+	uint8_t *rssi;     // RSSI / 2, 0 = not measured
+} ZoomCache;
+
 typedef struct MovingAverage {
 	uint16_t mean[128];
 	uint16_t buf[4][128];
@@ -179,7 +216,7 @@ typedef struct FreqPreset {
 	StepsCount stepsCountIndex;
 	uint8_t stepSizeIndex;
 	ModulationType modulationType;
-	BK4819_FilterBandwidth_t listenBW;
+	BK4819_filter_bandwidth_t listenBW;
 } FreqPreset;
 
 static const FreqPreset freqPresets[] = {
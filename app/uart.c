@@ -19,10 +19,16 @@
 #if !defined(ENABLE_OVERLAY)
 	#include "ARMCM0.h"
 #endif
+#ifdef ENABLE_SCAN_ACTIVITY
+	#include "app/activity.h"
+#endif
 #ifdef ENABLE_FMRADIO
 	#include "app/fm.h"
 #endif
 #include "app/uart.h"
+#ifdef ENABLE_WATCH_SLOTS
+	#include "app/watch.h"
+#endif
 #include "board.h"
 #include "bsp/dp32g030/dma.h"
 #include "bsp/dp32g030/gpio.h"
@@ -31,6 +37,7 @@
 #include "driver/crc.h"
 #include "driver/eeprom.h"
 #include "driver/gpio.h"
+#include "driver/st7565.h"
 #include "driver/uart.h"
 #include "functions.h"
 #include "misc.h"
@@ -138,6 +145,59 @@ typedef struct {
 	uint32_t Timestamp;
 } __attribute__((packed)) CMD_052F_t;
 
+#ifdef ENABLE_SCAN_ACTIVITY
+	typedef struct {
+		Header_t Header;
+		uint8_t  Channel;
+		uint8_t  Count;
+		uint8_t  Padding[2];
+		uint32_t Timestamp;
+	} __attribute__((packed)) CMD_0531_t;
+
+	typedef struct {
+		Header_t Header;
+		struct {
+			uint8_t    Channel;
+			uint8_t    Count;
+			uint16_t   Tick;           // current activity tick, to age the last heard times against
+			activity_t Activity[25];
+		} __attribute__((packed)) Data;
+	} __attribute__((packed)) REPLY_0531_t;
+#endif
+
+#ifdef ENABLE_WATCH_SLOTS
+	typedef struct {
+		Header_t Header;
+		uint32_t Timestamp;
+	} __attribute__((packed)) CMD_0533_t;
+
+	typedef struct {
+		Header_t Header;
+		struct {
+			uint8_t      Count;
+			uint8_t      Period_500ms;   // the sampling rates are visits per this period
+			uint8_t      Padding[2];
+			watch_slot_t Slot[WATCH_SLOT_NUM];
+		} __attribute__((packed)) Data;
+	} __attribute__((packed)) REPLY_0533_t;
+#endif
+
+typedef struct {
+	Header_t Header;
+	uint32_t Timestamp;
+} __attribute__((packed)) CMD_0535_t;
+
+typedef struct {
+	Header_t Header;
+	struct {
+		uint32_t SpiBytes;          // running total sent to the display
+		uint16_t SpiBytesPerSec;    // over the last whole second
+		uint16_t FramesRequested;   // screen redraws asked for, counted at most once per 10ms tick
+		uint16_t FramesRendered;    // screen redraws actually drawn
+		uint8_t  Padding[2];
+	} __attribute__((packed)) Data;
+} __attribute__((packed)) REPLY_0535_t;
+
 static const uint8_t Obfuscation[16] =
 {
 	0x16, 0x6C, 0x14, 0xE6, 0x2E, 0x91, 0x0D, 0x40, 0x21, 0x35, 0xD5, 0x40, 0x13, 0x03, 0xE9, 0x80
@@ -529,6 +589,76 @@ bool UART_IsCommandAvailable(void)
 	return (CRC_Calculate(UART_Command.Buffer, Size) != CRC) ? false : true;
 }
 
+#ifdef ENABLE_SCAN_ACTIVITY
+	static void CMD_0531(const uint8_t *pBuffer)
+	{	// read the channel activity table
+		const CMD_0531_t *pCmd = (const CMD_0531_t *)pBuffer;
+		REPLY_0531_t      Reply;
+		unsigned int      Count = pCmd->Count;
+
+		if (pCmd->Timestamp != Timestamp)
+			return;
+
+		if (pCmd->Channel > USER_CHANNEL_LAST)
+			Count = 0;
+		if (Count > ARRAY_SIZE(Reply.Data.Activity))
+			Count = ARRAY_SIZE(Reply.Data.Activity);
+		if (Count > (USER_CHANNEL_LAST + 1u - pCmd->Channel))
+			Count = USER_CHANNEL_LAST + 1u - pCmd->Channel;
+
+		memset(&Reply, 0, sizeof(Reply));
+		Reply.Header.ID    = 0x0532;
+		Reply.Header.Size  = 4 + (Count * sizeof(activity_t));
+		Reply.Data.Channel = pCmd->Channel;
+		Reply.Data.Count   = Count;
+		Reply.Data.Tick    = g_activity_tick_500ms;
+
+		memmove(Reply.Data.Activity, &g_activity[pCmd->Channel], Count * sizeof(activity_t));
+
+		SendReply(&Reply, sizeof(Reply.Header) + Reply.Header.Size);
+	}
+#endif
+
+#ifdef ENABLE_WATCH_SLOTS
+	static void CMD_0533(const uint8_t *pBuffer)
+	{	// read the dual watch slots and their sampling rates
+		const CMD_0533_t *pCmd = (const CMD_0533_t *)pBuffer;
+		REPLY_0533_t      Reply;
+
+		if (pCmd->Timestamp != Timestamp)
+			return;
+
+		memset(&Reply, 0, sizeof(Reply));
+		Reply.Header.ID         = 0x0534;
+		Reply.Header.Size       = 4 + (g_watch_slot_num * sizeof(watch_slot_t));
+		Reply.Data.Count        = g_watch_slot_num;
+		Reply.Data.Period_500ms = watch_period_500ms;
+
+		memmove(Reply.Data.Slot, g_watch_slot, g_watch_slot_num * sizeof(watch_slot_t));
+
+		SendReply(&Reply, sizeof(Reply.Header) + Reply.Header.Size);
+	}
+#endif
+
+static void CMD_0535(const uint8_t *pBuffer)
+{	// read the display statistics
+	const CMD_0535_t *pCmd = (const CMD_0535_t *)pBuffer;
+	REPLY_0535_t      Reply;
+
+	if (pCmd->Timestamp != Timestamp)
+		return;
+
+	memset(&Reply, 0, sizeof(Reply));
+	Reply.Header.ID           = 0x0536;
+	Reply.Header.Size         = sizeof(Reply.Data);
+	Reply.Data.SpiBytes        = g_st7565_spi_bytes;
+	Reply.Data.SpiBytesPerSec  = g_st7565_spi_bytes_per_sec;
+	Reply.Data.FramesRequested = g_gui_frames_requested;
+	Reply.Data.FramesRendered  = g_gui_frames_rendered;
+
+	SendReply(&Reply, sizeof(Reply));
+}
+
 void UART_HandleCommand(void)
 {
 	switch (UART_Command.Header.ID)
@@ -566,6 +696,22 @@ void UART_HandleCommand(void)
 		case 0x052F:
 			CMD_052F(UART_Command.Buffer);
 			break;
+
+		#ifdef ENABLE_SCAN_ACTIVITY
+			case 0x0531:
+				CMD_0531(UART_Command.Buffer);
+				break;
+		#endif
+
+		#ifdef ENABLE_WATCH_SLOTS
+			case 0x0533:
+				CMD_0533(UART_Command.Buffer);
+				break;
+		#endif
+
+		case 0x0535:
+			CMD_0535(UART_Command.Buffer);
+			break;
 	
 		case 0x05DD:
 			#if defined(ENABLE_OVERLAY)
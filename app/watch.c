@@ -0,0 +1,118 @@
+/* Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#include <string.h>
+
+#include "app/watch.h"
+#include "driver/eeprom.h"
+#include "misc.h"
+#include "radio.h"
+
+watch_slot_t   g_watch_slot[WATCH_SLOT_NUM];
+uint8_t        g_watch_slot_num;
+
+static uint8_t period_count_500ms;
+
+void WATCH_Refresh(void)
+{	// VFO A and B are always watched, the memory slots are the first few channels in WATCH_SLOT_SCAN_LIST
+	const uint8_t *chans = g_scan_list_channels[WATCH_SLOT_SCAN_LIST];
+	const uint8_t  count = g_scan_list_count[WATCH_SLOT_SCAN_LIST];
+	unsigned int   num   = WATCH_VFO_SLOT_NUM;
+	unsigned int   i;
+
+	for (i = 0; i < count && num < WATCH_SLOT_NUM; i++)
+	{
+		watch_slot_t *pSlot = &g_watch_slot[num];
+		const uint8_t chan  = chans[i];
+
+		if (pSlot->channel != chan)
+		{	// new channel in this slot - start afresh
+			memset(pSlot, 0, sizeof(*pSlot));
+			pSlot->channel = chan;
+		}
+		EEPROM_ReadBuffer(chan * 16, &pSlot->frequency, 4);
+		num++;
+	}
+
+	for (i = 0; i < num; i++)
+		if (g_watch_slot[i].weight == 0)
+			g_watch_slot[i].weight = 1;
+
+	g_watch_slot_num = num;
+}
+
+void WATCH_Heard(const unsigned int slot)
+{	// squelch opened on a slot, give it more of the watch time for a while
+	watch_slot_t *pSlot;
+
+	if (slot >= g_watch_slot_num)
+		return;
+
+	pSlot = &g_watch_slot[slot];
+	pSlot->weight += 2;
+	if (pSlot->weight > WATCH_WEIGHT_MAX)
+		pSlot->weight = WATCH_WEIGHT_MAX;
+}
+
+void WATCH_TimeSlice500ms(void)
+{
+	unsigned int i;
+
+	if (++period_count_500ms < watch_period_500ms)
+		return;
+	period_count_500ms = 0;
+
+	for (i = 0; i < g_watch_slot_num; i++)
+	{
+		watch_slot_t *pSlot = &g_watch_slot[i];
+
+		pSlot->rate   = pSlot->visits;
+		pSlot->visits = 0;
+
+		if (pSlot->weight > 1)
+			pSlot->weight--;     // activity fades
+	}
+
+	WATCH_Refresh();    // pick up any scan list changes
+}
+
+uint8_t WATCH_NextSlot(void)
+{	// smooth weighted round robin, busy slots come round more often but no slot is starved
+	unsigned int total = 0;
+	unsigned int best  = 0;
+	unsigned int i;
+
+	if (g_watch_slot_num == 0)
+		WATCH_Refresh();
+
+	for (i = 0; i < g_watch_slot_num; i++)
+	{
+		watch_slot_t *pSlot = &g_watch_slot[i];
+
+		pSlot->credit += pSlot->weight;
+		total         += pSlot->weight;
+
+		if (pSlot->credit > g_watch_slot[best].credit)
+			best = i;
+	}
+
+	g_watch_slot[best].credit -= total;
+
+	if (g_watch_slot[best].visits < 255)
+		g_watch_slot[best].visits++;
+
+	return best;
+}
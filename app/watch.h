@@ -0,0 +1,47 @@
+/* Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#ifndef APP_WATCH_H
+#define APP_WATCH_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "radio.h"
+
+#define WATCH_VFO_SLOT_NUM   2                        // VFO A and VFO B
+#define WATCH_SLOT_NUM       (WATCH_VFO_SLOT_NUM + 3) // plus up to 3 memory channels ..
+#define WATCH_SLOT_SCAN_LIST SCAN_LIST_2              // .. the first ones in this scan list ('S ADD2')
+#define WATCH_WEIGHT_MAX     8
+
+typedef struct {
+	uint32_t frequency;    // memory slots only, cached so the EEPROM isn't read during a peek
+	uint8_t  channel;      // memory slots only
+	uint8_t  weight;       // 1 + recent activity
+	int8_t   credit;       // weighted round robin
+	uint8_t  visits;       // visits so far in this period
+	uint8_t  rate;         // visits in the last complete period
+} __attribute__((packed)) watch_slot_t;
+
+extern watch_slot_t g_watch_slot[WATCH_SLOT_NUM];
+extern uint8_t      g_watch_slot_num;
+
+void    WATCH_Refresh(void);
+void    WATCH_Heard(const unsigned int slot);
+void    WATCH_TimeSlice500ms(void);
+uint8_t WATCH_NextSlot(void);
+
+#endif
@@ -697,6 +697,12 @@ void BOARD_EEPROM_Init(void)
 		g_eeprom.scan_list_priority_ch1[i] =  Data[j + 1];
 		g_eeprom.scan_list_priority_ch2[i] =  Data[j + 2];
 	}
+	#ifdef ENABLE_SCAN_RANGES
+		g_eeprom.scan_range_enable = (Data[7] < 4) ? (Data[7] >> 0) & 1u : false;
+	#endif
+	#ifdef ENABLE_SCAN_ACTIVITY
+		g_eeprom.scan_active_first = (Data[7] < 4) ? (Data[7] >> 1) & 1u : false;
+	#endif
 
 	// 0F40..0F47
 	EEPROM_ReadBuffer(0x0F40, Data, 8);
@@ -726,6 +732,7 @@ void BOARD_EEPROM_Init(void)
 
 	// 0D60..0E27
 	EEPROM_ReadBuffer(0x0D60, g_user_channel_attributes, sizeof(g_user_channel_attributes));
+	RADIO_InitScanLists();
 
 	// 0F30..0F3F
 	EEPROM_ReadBuffer(0x0F30, g_custom_aes_key, sizeof(g_custom_aes_key));
@@ -45,6 +45,36 @@ const uint16_t DCS_OPTIONS[104] = {
 	0x01C3, 0x01CA, 0x01D3, 0x01D9, 0x01DA, 0x01DC, 0x01E3, 0x01EC,
 };
 
+// every normal DCS codeword reduced to its smallest 23 bit rotation, sorted for a binary search.
+// the inverted codewords are rotations of normal ones, so they share these entries.
+// DCS_CANONICAL_CODE holds the matching DCS_OPTIONS index.
+static const uint32_t DCS_CANONICAL[104] = {
+	0x013EC7, 0x015D6F, 0x016CBB, 0x019A3F, 0x01ABEB, 0x01E17D, 0x01F997, 0x023B6D,
+	0x0271FB, 0x029F95, 0x02B6AB, 0x02CDE9, 0x02E4D7, 0x02FC3D, 0x0309DF, 0x035BA3,
+	0x036A77, 0x03729D, 0x039CF3, 0x03AD27, 0x03B5CD, 0x03CE8F, 0x03D665, 0x03E7B1,
+	0x044B7B, 0x047AAF, 0x04C6BD, 0x04DE57, 0x04F769, 0x052BB5, 0x05335F, 0x0550F7,
+	0x0579C9, 0x058F4D, 0x0597A7, 0x05A673, 0x05BE99, 0x05C5DB, 0x05DD31, 0x05ECE5,
+	0x062E1F, 0x0636F5, 0x064DB7, 0x06555D, 0x067C63, 0x068AE7, 0x06A3D9, 0x06BB33,
+	0x06D89B, 0x06E94F, 0x06F1A5, 0x071CAD, 0x072D79, 0x073593, 0x074ED1, 0x07563B,
+	0x07916B, 0x07EA29, 0x08AB57, 0x08B3BD, 0x08F92B, 0x0925F7, 0x093D1D, 0x09465F,
+	0x095EB5, 0x09778B, 0x0999E5, 0x09CB99, 0x09D373, 0x09E2A7, 0x09FA4D, 0x0A38B7,
+	0x0A5B1F, 0x0A6ACB, 0x0AAD9B, 0x0ACE33, 0x0AD6D9, 0x0B233B, 0x0B69AD, 0x0B9F29,
+	0x0BCD55, 0x0BE46B, 0x0C7975, 0x0C971B, 0x0CA6CF, 0x0CDD8D, 0x0CF4B3, 0x0D4BC7,
+	0x0D532D, 0x0D947D, 0x0DA5A9, 0x0E4E6D, 0x0E6753, 0x0E91D7, 0x0EEA95, 0x0F3649,
+	0x126EA5, 0x12764F, 0x12A9F5, 0x12CA5D, 0x12D2B7, 0x132755, 0x1534EB, 0x156697,
+};
+
+static const uint8_t DCS_CANONICAL_CODE[104] = {
+	  0,   1,   2,   3,   4,   5,  90,   6,   7,   8,   9,  10,  77,
+	 31,  18,  11, 101,  81,  12,  13,  14,  15,  89, 103,  37,  62,
+	 16,  17,  64,  19,  92,  20,  65,  61,  21,  22,  66,  23,  33,
+	 97,  32,  24,  78,  25,  51,  96,  26,  87,  27,  28,  79,  84,
+	 29,  93, 100,  30,  47,  39,  34,  46,  63,  70,  35,  80,  36,
+	 45,  91,  67,  98,  42,  76,  38,  40,  41,  43,  88,  44,  68,
+	 48,  49,  50,  69,  86,  52, 102,  53,  85,  57,  54,  55,  56,
+	 95,  58,  59,  60,  94,  71,  99,  72,  73,  74,  75,  82,  83,
+};
+
 static uint32_t DCS_CalculateGolay(uint32_t CodeWord)
 {
 	unsigned int i;
@@ -66,26 +96,59 @@ uint32_t DCS_GetGolayCodeWord(dcs_code_type_t code_type, uint8_t Option)
 	return code;
 }
 
+static uint32_t DCS_Rotate(const uint32_t Code)
+{	// rotate right by one bit within the 23 bit word
+	return (Code >> 1) | ((Code & 1u) << 22);
+}
+
 uint8_t DCS_GetCdcssCode(uint32_t Code)
-{
+{	// find the DCS code that the received (and arbitrarily rotated) 23 bit word belongs to
+	unsigned int num_rotations = 23;
+	uint32_t     Canonical;
+	uint32_t     Word;
+	uint32_t     Golay;
+	unsigned int lo;
+	unsigned int hi;
 	unsigned int i;
-	for (i = 0; i < 23; i++)
+
+	if (Code & ~0x7FFFFFU)
+	{	// 24 bit result (BK4819v3), fold the top bit in with one rotation and don't count it
+		Code          = DCS_Rotate(Code) & 0x7FFFFFU;
+		num_rotations = 22;
+	}
+
+	// reduce to the smallest rotation
+	Canonical = Code;
+	Word      = Code;
+	for (i = 1; i < 23; i++)
 	{
-		uint32_t Shift;
+		Word = DCS_Rotate(Word);
+		if (Canonical > Word)
+			Canonical = Word;
+	}
 
-		if (((Code >> 9) & 0x7U) == 4)
-		{
-			unsigned int j;
-			for (j = 0; j < ARRAY_SIZE(DCS_OPTIONS); j++)
-				if (DCS_OPTIONS[j] == (Code & 0x1FF))
-					if (DCS_GetGolayCodeWord(2, j) == Code)
-						return j;
-		}
+	// binary search the sorted canonical codeword table
+	lo = 0;
+	hi = ARRAY_SIZE(DCS_CANONICAL);
+	while (lo < hi)
+	{
+		const unsigned int mid = (lo + hi) / 2;
+		if (DCS_CANONICAL[mid] < Canonical)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
 
-		Shift = Code >> 1;
-		if (Code & 1U)
-			Shift |= 0x400000U;
-		Code = Shift;
+	if (lo >= ARRAY_SIZE(DCS_CANONICAL) || DCS_CANONICAL[lo] != Canonical)
+		return 0xFF;
+
+	// only accept it if the codeword is reached within the allowed number of rotations
+	Golay = DCS_GetGolayCodeWord(CODE_TYPE_DIGITAL, DCS_CANONICAL_CODE[lo]);
+	for (i = 0; i < num_rotations; i++)
+	{
+		if (Code == Golay)
+			return DCS_CANONICAL_CODE[lo];
+		Code = DCS_Rotate(Code);
 	}
 
 	return 0xFF;
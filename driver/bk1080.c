@@ -34,49 +34,156 @@ static const uint16_t BK1080_RegisterTable[] =
 	0x0200, 0x0000,
 };
 
-static bool gIsInitBK1080;
+enum {
+	BK1080_STATE_IDLE = 0,
+	BK1080_STATE_OSC_SETTLE,
+	BK1080_STATE_CALIBRATE,
+	BK1080_STATE_TUNE,
+	BK1080_STATE_SEEK_TUNING,     // seek asked for, waiting for the last tune to finish
+	BK1080_STATE_SEEK_CLEAR,      // TUNE/SEEK cleared, waiting for STC to follow
+};
+
+static bool     gIsInitBK1080;
+static uint8_t  g_bk1080_state;
+static uint8_t  g_bk1080_count_down_10ms;
+static uint16_t g_bk1080_frequency;
+static bool     g_bk1080_tune_set;     // TUNE left set in REG 03
+static bool     g_bk1080_seek_up;
+static bool     g_bk1080_seek_pending; // asked for during the power up
 
 uint16_t BK1080_BaseFrequency;
 uint16_t BK1080_FrequencyDeviation;
 
+static void BK1080_WriteRegisters(BK1080_Register_t Register, const uint16_t *pValues, unsigned int Count)
+{	// the register address auto-increments, so a whole block goes in one transfer
+	unsigned int i;
+
+	I2C_Start();
+	I2C_Write(0x80);
+	I2C_Write((Register << 1) | I2C_WRITE);
+	for (i = 0; i < Count; i++)
+	{
+		I2C_Write((pValues[i] >> 8) & 0xFF);
+		I2C_Write((pValues[i] >> 0) & 0xFF);
+	}
+	I2C_Stop();
+}
+
+static void BK1080_StartTune(void)
+{	// the TUNE bit is set by BK1080_TimeSlice10ms once the channel has settled
+	BK1080_WriteRegister(BK1080_REG_05_SYSTEM_CONFIGURATION2, 0x0A5F);
+	BK1080_WriteRegister(BK1080_REG_03_CHANNEL, g_bk1080_frequency - 760);
+
+	g_bk1080_state           = BK1080_STATE_TUNE;
+	g_bk1080_count_down_10ms = bk1080_tune_10ms;
+}
+
 void BK1080_Init(uint16_t Frequency, bool bDoScan)
 {
-	unsigned int i;
+	g_bk1080_seek_pending = false;
 
 	if (bDoScan)
 	{
 		GPIO_ClearBit(&GPIOB->DATA, GPIOB_PIN_BK1080);
 
+		g_bk1080_frequency = Frequency;
+
 		if (!gIsInitBK1080)
-		{
-			for (i = 0; i < ARRAY_SIZE(BK1080_RegisterTable); i++)
-				BK1080_WriteRegister(i, BK1080_RegisterTable[i]);
+		{	// the oscillator settle and calibration waits run from BK1080_TimeSlice10ms
+			BK1080_WriteRegisters(0, BK1080_RegisterTable, ARRAY_SIZE(BK1080_RegisterTable));
+
+			g_bk1080_state           = BK1080_STATE_OSC_SETTLE;
+			g_bk1080_count_down_10ms = bk1080_osc_settle_10ms;
+			return;
+		}
 
-			SYSTEM_DelayMs(250);
+		BK1080_WriteRegister(BK1080_REG_02_POWER_CONFIGURATION, 0x0201);
+		BK1080_StartTune();
+	}
+	else
+	{	// a power up still in progress is abandoned and redone next time
+		g_bk1080_state = BK1080_STATE_IDLE;
 
-			BK1080_WriteRegister(BK1080_REG_25_INTERNAL, 0xA83C);
-			BK1080_WriteRegister(BK1080_REG_25_INTERNAL, 0xA8BC);
+		BK1080_WriteRegister(BK1080_REG_02_POWER_CONFIGURATION, 0x0241);
+		GPIO_SetBit(&GPIOB->DATA, GPIOB_PIN_BK1080);
+	}
+}
 
-			SYSTEM_DelayMs(60);
+static void BK1080_SeekClearTune(void)
+{	// stay on the channel the chip is on but drop TUNE, STC then clears
+	const uint16_t Channel = BK1080_REG_11_GET_READCHAN(BK1080_ReadRegister(BK1080_REG_11_READ_CHANNEL));
 
-			gIsInitBK1080 = true;
-		}
-		else
-		{
-			BK1080_WriteRegister(BK1080_REG_02_POWER_CONFIGURATION, 0x0201);
-		}
+	BK1080_WriteRegister(BK1080_REG_03_CHANNEL, Channel);
+	g_bk1080_tune_set = false;
+
+	g_bk1080_state           = BK1080_STATE_SEEK_CLEAR;
+	g_bk1080_count_down_10ms = bk1080_stc_timeout_10ms;
+}
 
-		BK1080_WriteRegister(BK1080_REG_05_SYSTEM_CONFIGURATION2, 0x0A5F);
-		BK1080_WriteRegister(BK1080_REG_03_CHANNEL, Frequency - 760);
+static void BK1080_Seek(void)
+{	// the chip steps through the band on its own and raises STC on the first channel
+	// that passes its RSSI/SNR thresholds, or with SF/BL set at the band edge
+	uint16_t Value = 0x0201 | BK1080_REG_02_SKMODE_STOP | BK1080_REG_02_MASK_SEEK;
 
-		SYSTEM_DelayMs(10);
+	if (!g_bk1080_seek_up)
+		Value &= ~BK1080_REG_02_MASK_SEEKUP;
+
+	BK1080_WriteRegister(BK1080_REG_02_POWER_CONFIGURATION, Value);
+}
+
+void BK1080_TimeSlice10ms(void)
+{
+	if (g_bk1080_state == BK1080_STATE_IDLE)
+		return;
 
-		BK1080_WriteRegister(BK1080_REG_03_CHANNEL, (Frequency - 760) | 0x8000);
+	// the seek states poll STC every tick, their count down is only a time limit
+	if (g_bk1080_state == BK1080_STATE_SEEK_TUNING)
+	{
+		if ((BK1080_ReadRegister(BK1080_REG_10) & BK1080_REG_10_MASK_STC) == 0 && --g_bk1080_count_down_10ms > 0)
+			return;     // still tuning
+		BK1080_SeekClearTune();
+		return;
 	}
-	else
+
+	if (g_bk1080_state == BK1080_STATE_SEEK_CLEAR)
 	{
-		BK1080_WriteRegister(BK1080_REG_02_POWER_CONFIGURATION, 0x0241);
-		GPIO_SetBit(&GPIOB->DATA, GPIOB_PIN_BK1080);
+		if ((BK1080_ReadRegister(BK1080_REG_10) & BK1080_REG_10_MASK_STC) != 0 && --g_bk1080_count_down_10ms > 0)
+			return;     // STC not cleared yet
+		BK1080_Seek();
+		g_bk1080_state = BK1080_STATE_IDLE;
+		return;
+	}
+
+	if (g_bk1080_count_down_10ms > 0 && --g_bk1080_count_down_10ms > 0)
+		return;
+
+	switch (g_bk1080_state)
+	{
+		case BK1080_STATE_OSC_SETTLE:
+			BK1080_WriteRegister(BK1080_REG_25_INTERNAL, 0xA83C);
+			BK1080_WriteRegister(BK1080_REG_25_INTERNAL, 0xA8BC);
+
+			g_bk1080_state           = BK1080_STATE_CALIBRATE;
+			g_bk1080_count_down_10ms = bk1080_calibrate_10ms;
+			break;
+
+		case BK1080_STATE_CALIBRATE:
+			gIsInitBK1080 = true;
+			BK1080_StartTune();
+			break;
+
+		case BK1080_STATE_TUNE:
+			BK1080_WriteRegister(BK1080_REG_03_CHANNEL, (g_bk1080_frequency - 760) | BK1080_REG_03_MASK_TUNE);
+			g_bk1080_tune_set = true;
+			g_bk1080_state    = BK1080_STATE_IDLE;
+
+			if (g_bk1080_seek_pending)
+			{	// now the chip is calibrated and tuned
+				g_bk1080_seek_pending    = false;
+				g_bk1080_state           = BK1080_STATE_SEEK_TUNING;
+				g_bk1080_count_down_10ms = bk1080_stc_timeout_10ms;
+			}
+			break;
 	}
 }
 
@@ -110,9 +217,60 @@ void BK1080_Mute(bool Mute)
 
 void BK1080_SetFrequency(uint16_t Frequency)
 {
+	g_bk1080_frequency    = Frequency;
+	g_bk1080_seek_pending = false;     // a tune replaces any seek not yet started
+
+	if (g_bk1080_state == BK1080_STATE_SEEK_TUNING || g_bk1080_state == BK1080_STATE_SEEK_CLEAR)
+		g_bk1080_state = BK1080_STATE_IDLE;     // a seek not yet started is dropped
+	else
+	if (g_bk1080_state != BK1080_STATE_IDLE)
+		return;     // the power up in progress tunes to it when it's done
+
 	BK1080_WriteRegister(BK1080_REG_03_CHANNEL, Frequency - 760);
 	SYSTEM_DelayMs(10);
-	BK1080_WriteRegister(BK1080_REG_03_CHANNEL, (Frequency - 760) | 0x8000);
+	BK1080_WriteRegister(BK1080_REG_03_CHANNEL, (Frequency - 760) | BK1080_REG_03_MASK_TUNE);
+	g_bk1080_tune_set = true;
+}
+
+void BK1080_StartSeek(bool Up)
+{	// SEEK is only set once TUNE is cleared and STC has followed it, else the first STC
+	// seen could be the one left over from the last tune .. BK1080_IsBusy() until then
+	g_bk1080_seek_up = Up;
+
+	if (g_bk1080_state == BK1080_STATE_SEEK_TUNING || g_bk1080_state == BK1080_STATE_SEEK_CLEAR)
+		return;     // already on its way
+
+	if (g_bk1080_state != BK1080_STATE_IDLE)
+	{	// power up in progress, the seek follows its tune
+		g_bk1080_seek_pending = true;
+		return;
+	}
+
+	if (g_bk1080_tune_set)
+		g_bk1080_state = BK1080_STATE_SEEK_TUNING;
+	else
+		g_bk1080_state = BK1080_STATE_SEEK_CLEAR;
+	g_bk1080_count_down_10ms = bk1080_stc_timeout_10ms;
+}
+
+void BK1080_StopSeek(void)
+{	// clearing SEEK also clears STC, ready for the next seek
+	g_bk1080_seek_pending = false;
+
+	if (g_bk1080_state == BK1080_STATE_SEEK_TUNING || g_bk1080_state == BK1080_STATE_SEEK_CLEAR)
+		g_bk1080_state = BK1080_STATE_IDLE;
+
+	BK1080_WriteRegister(BK1080_REG_02_POWER_CONFIGURATION, 0x0201);
+}
+
+bool BK1080_IsBusy(void)
+{	// powering up, tuning or getting ready to seek
+	return g_bk1080_state != BK1080_STATE_IDLE;
+}
+
+uint16_t BK1080_GetFrequency(void)
+{
+	return 760 + BK1080_REG_11_GET_READCHAN(BK1080_ReadRegister(BK1080_REG_11_READ_CHANNEL));
 }
 
 void BK1080_GetFrequencyDeviation(uint16_t Frequency)
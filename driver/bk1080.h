@@ -25,11 +25,16 @@ extern uint16_t BK1080_BaseFrequency;
 extern uint16_t BK1080_FrequencyDeviation;
 
 void BK1080_Init(uint16_t Frequency, bool bDoScan);
+void BK1080_TimeSlice10ms(void);
 uint16_t BK1080_ReadRegister(BK1080_Register_t Register);
 void BK1080_WriteRegister(BK1080_Register_t Register, uint16_t Value);
 void BK1080_Mute(bool Mute);
 void BK1080_SetFrequency(uint16_t Frequency);
 void BK1080_GetFrequencyDeviation(uint16_t Frequency);
+void BK1080_StartSeek(bool Up);
+void BK1080_StopSeek(void);
+bool BK1080_IsBusy(void);
+uint16_t BK1080_GetFrequency(void);
 
 #endif
 
@@ -712,6 +712,19 @@ void BK4819_SetFrequency(uint32_t Frequency)
 	BK4819_WriteRegister(BK4819_REG_39, (Frequency >> 16) & 0xFFFF);
 }
 
+void BK4819_SetFrequencyFast(uint32_t Frequency)
+{	// retune the receiver only, nothing else is touched
+
+	const uint16_t reg = BK4819_ReadRegister(BK4819_REG_30);
+
+	BK4819_SetFrequency(Frequency);
+	BK4819_PickRXFilterPathBasedOnFrequency(Frequency);
+
+	// toggle the VCO/PLL enables so it relocks on the new frequency
+	BK4819_WriteRegister(BK4819_REG_30, 0);
+	BK4819_WriteRegister(BK4819_REG_30, reg);
+}
+
 void BK4819_SetupSquelch(
 		uint8_t squelch_open_rssi_thresh,
 		uint8_t squelch_close_rssi_thresh,
@@ -807,6 +820,20 @@ void BK4819_SetAF(BK4819_af_type_t AF)
 	BK4819_WriteRegister(BK4819_REG_47, 0x6040 | (AF << 8));
 }
 
+#ifdef ENABLE_PANADAPTER
+	void BK4819_ToggleAFBit(const bool on)
+	{	// REG_47 <8> AF output enable
+		const uint16_t reg = BK4819_ReadRegister(BK4819_REG_47);
+		BK4819_WriteRegister(BK4819_REG_47, on ? (reg | (1u << 8)) : (reg & ~(1u << 8)));
+	}
+
+	void BK4819_ToggleAFDAC(const bool on)
+	{	// REG_30 <9> AF DAC enable
+		const uint16_t reg = BK4819_ReadRegister(BK4819_REG_30);
+		BK4819_WriteRegister(BK4819_REG_30, on ? (reg | (1u << 9)) : (reg & ~(1u << 9)));
+	}
+#endif
+
 void BK4819_RX_TurnOn(void)
 {
 	// DSP Voltage Setting = 1
@@ -1686,6 +1713,11 @@ uint8_t BK4819_GetCTCType(void)
 	return (BK4819_ReadRegister(BK4819_REG_0C) >> 10) & 3u;
 }
 
+bool BK4819_IsSquelchOpen(void)
+{
+	return (BK4819_ReadRegister(BK4819_REG_0C) >> 1) & 1u;
+}
+
 void BK4819_SendFSKData(uint16_t *pData)
 {
 	unsigned int i;
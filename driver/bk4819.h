@@ -78,6 +78,7 @@ void     BK4819_EnableVox(uint16_t Vox1Threshold, uint16_t Vox0Threshold);
 void     BK4819_SetFilterBandwidth(const BK4819_filter_bandwidth_t Bandwidth, const bool weak_no_different);
 void     BK4819_SetupPowerAmplifier(const uint8_t bias, const uint32_t frequency);
 void     BK4819_SetFrequency(uint32_t Frequency);
+void     BK4819_SetFrequencyFast(uint32_t Frequency);
 void     BK4819_SetupSquelch(
 			uint8_t SquelchOpenRSSIThresh,
 			uint8_t SquelchCloseRSSIThresh,
@@ -107,6 +108,10 @@ void     BK4819_TurnsOffTones_TurnsOnRX(void);
 #ifdef ENABLE_AIRCOPY
 	void     BK4819_SetupAircopy(void);
 #endif
+#ifdef ENABLE_PANADAPTER
+	void     BK4819_ToggleAFBit(const bool on);
+	void     BK4819_ToggleAFDAC(const bool on);
+#endif
 void     BK4819_ResetFSK(void);
 void     BK4819_Idle(void);
 void     BK4819_ExitBypass(void);
@@ -150,6 +155,7 @@ uint8_t  BK4819_GetDTMF_5TONE_Code(void);
 uint8_t  BK4819_get_CDCSS_code_type(void);
 uint8_t  BK4819_GetCTCShift(void);
 uint8_t  BK4819_GetCTCType(void);
+bool     BK4819_IsSquelchOpen(void);
 
 void     BK4819_SendFSKData(uint16_t *pData);
 void     BK4819_PrepareFSKReceive(void);
@@ -16,23 +16,251 @@
 
 #include <stdint.h>
 #include <stdio.h>     // NULL
+#include <string.h>
 
+#ifdef ENABLE_LCD_DMA
+	#include "bsp/dp32g030/dma.h"
+#endif
 #include "bsp/dp32g030/gpio.h"
 #include "bsp/dp32g030/spi.h"
 #include "driver/gpio.h"
 #include "driver/spi.h"
 #include "driver/st7565.h"
 #include "driver/system.h"
+#ifdef ENABLE_LCD_DMA
+	#include "driver/systick.h"
+#endif
 #include "misc.h"
 
 uint8_t g_status_line[128];
 uint8_t g_frame_buffer[7][128];
 uint8_t contrast = 31;  // 0 ~ 63
 
+uint32_t g_st7565_spi_bytes;
+uint16_t g_st7565_spi_bytes_per_sec;
+
+// a hash of each segment as it was last sent, [0..6] the frame buffer pages, [7] the status line
+static uint16_t sent_hash[8][ST7565_SEGMENTS];
+static uint8_t  force_segments[8];      // bit per segment, resend regardless of the hash
+static uint8_t  blits_to_refresh;
+static uint32_t last_spi_bytes;
+
+#ifdef ENABLE_LCD_DMA
+	// DMA handshake line for the SPI0 TX FIFO (UART1 TX/RX are MS0/MS1)
+	// not yet confirmed on hardware, hence the timeout below
+	#define ST7565_DMA_SEL          DMA_CH_MOD_MD_SEL_BITS_HSREQ_MS4
+
+	// a whole page takes ~200us at the SPI0 rate, no transfer complete
+	// by then means the handshake isn't working
+	#define ST7565_DMA_TIMEOUT_US   2000
+
+	// pages are copied here before going out, the frame buffer can be drawn into again
+	// straight away, and one buffer is filled while the other is still being sent
+	static uint8_t  dma_page[2][LCD_WIDTH];
+	static uint8_t  dma_page_index;
+	static bool     dma_busy;
+	static bool     dma_failed;       // a transfer timed out, pages are sent polled from then on
+	static uint32_t dma_start_tick;
+
+	// the page in flight, resent polled if the transfer times out
+	static const uint8_t *dma_buffer;
+	static uint8_t        dma_column;
+	static uint8_t        dma_line;
+	static uint8_t        dma_size;
+#endif
+
+static void ST7565_WriteData(const uint8_t *pBuffer, const unsigned int Size)
+{	// polled, display column/line already selected and A0 set
+	unsigned int i;
+
+	for (i = 0; i < Size; i++)
+	{
+		while ((SPI0->FIFOST & SPI_FIFOST_TFF_MASK) != SPI_FIFOST_TFF_BITS_NOT_FULL) {}
+		SPI0->WDR = pBuffer[i];
+	}
+	g_st7565_spi_bytes += Size;
+
+	SPI_WaitForUndocumentedTxFifoStatusBit();
+}
+
+#ifdef ENABLE_LCD_DMA
+	static void ST7565_StartDma(const uint8_t *pBuffer, const unsigned int Size)
+	{
+		DMA_CTR = (DMA_CTR & ~DMA_CTR_DMAEN_MASK) | DMA_CTR_DMAEN_BITS_ENABLE;
+
+		DMA_CH1->CTR    = 0;
+		DMA_CH1->MSADDR = (uint32_t)(uintptr_t)pBuffer;
+		DMA_CH1->MDADDR = (uint32_t)(uintptr_t)&SPI0->WDR;
+		DMA_CH1->MOD    = 0
+			// Source
+			| DMA_CH_MOD_MS_ADDMOD_BITS_INCREMENT
+			| DMA_CH_MOD_MS_SIZE_BITS_8BIT
+			| DMA_CH_MOD_MS_SEL_BITS_SRAM
+			// Destination
+			| DMA_CH_MOD_MD_ADDMOD_BITS_NONE
+			| DMA_CH_MOD_MD_SIZE_BITS_8BIT
+			| ST7565_DMA_SEL
+			;
+		DMA_INTST = DMA_INTST_CH1_TC_INTST_BITS_SET;
+
+		dma_busy       = true;
+		dma_start_tick = SYSTICK_GetTick();
+
+		// LENGTH is the byte count less one, same as the UART RX set-up
+		DMA_CH1->CTR = 0
+			| DMA_CH_CTR_CH_EN_BITS_ENABLE
+			| (((Size - 1) << DMA_CH_CTR_LENGTH_SHIFT) & DMA_CH_CTR_LENGTH_MASK)
+			| DMA_CH_CTR_LOOP_BITS_DISABLE
+			| DMA_CH_CTR_PRI_BITS_LOW
+			;
+
+		SPI0->CR = (SPI0->CR & ~SPI_CR_TXDMAEN_MASK) | SPI_CR_TXDMAEN_BITS_ENABLE;
+	}
+#endif
+
+bool ST7565_IsBusy(void)
+{	// true while a page is still on its way to the display
+	#ifdef ENABLE_LCD_DMA
+		if (dma_busy && (DMA_INTST & DMA_INTST_CH1_TC_INTST_MASK) != 0)
+		{	// transfer complete, let the FIFO drain and release the display
+			DMA_INTST = DMA_INTST_CH1_TC_INTST_BITS_SET;
+			SPI0->CR  = (SPI0->CR & ~SPI_CR_TXDMAEN_MASK) | SPI_CR_TXDMAEN_BITS_DISABLE;
+			SPI_WaitForUndocumentedTxFifoStatusBit();
+			SPI_ToggleMasterMode(&SPI0->CR, true);
+			dma_busy = false;
+		}
+		else
+		if (dma_busy && SYSTICK_GetElapsedUs(dma_start_tick) >= ST7565_DMA_TIMEOUT_US)
+		{	// no handshake from SPI0, stop the channel and send the page the slow way
+			DMA_CH1->CTR = 0;
+			DMA_INTST    = DMA_INTST_CH1_TC_INTST_BITS_SET;
+			SPI0->CR     = (SPI0->CR & ~SPI_CR_TXDMAEN_MASK) | SPI_CR_TXDMAEN_BITS_DISABLE;
+			SPI_WaitForUndocumentedTxFifoStatusBit();
+
+			dma_failed = true;
+			dma_busy   = false;
+
+			ST7565_SelectColumnAndLine(dma_column, dma_line);
+			GPIO_SetBit(&GPIOB->DATA, GPIOB_PIN_ST7565_A0);
+			ST7565_WriteData(dma_buffer, dma_size);
+
+			SPI_ToggleMasterMode(&SPI0->CR, true);
+		}
+		return dma_busy;
+	#else
+		return false;
+	#endif
+}
+
+static void ST7565_WaitIdle(void)
+{	// must come before anything else is written to the display, bounded by the DMA timeout
+	while (ST7565_IsBusy()) {}
+}
+
+static unsigned int ST7565_HashIndex(const unsigned int Line)
+{	// display page -> sent_hash[] index
+	return (Line == 0) ? 7 : Line - 1;
+}
+
+static void ST7565_SendPage(const unsigned int Line, const uint8_t *pBuffer)
+{	// only the span from the first to the last changed segment goes out
+	const unsigned int index = ST7565_HashIndex(Line);
+	uint16_t           hash[ST7565_SEGMENTS];
+	unsigned int       first = ST7565_SEGMENTS;
+	unsigned int       last  = 0;
+	unsigned int       seg;
+	unsigned int       i;
+
+	for (seg = 0; seg < ST7565_SEGMENTS; seg++)
+	{
+		const uint8_t *p = pBuffer + (seg * ST7565_SEGMENT_WIDTH);
+		uint16_t       h = 5381;
+
+		for (i = 0; i < ST7565_SEGMENT_WIDTH; i++)
+			h = (h << 5) + h + p[i];
+		hash[seg] = h;
+
+		if (h != sent_hash[index][seg] || (force_segments[index] & (1u << seg)))
+		{
+			if (first == ST7565_SEGMENTS)
+				first = seg;
+			last = seg;
+		}
+	}
+
+	if (first == ST7565_SEGMENTS)
+		return;     // nothing changed
+
+	#ifdef ENABLE_LCD_DMA
+		if (!dma_failed)
+		{	// only one page is ever in flight, this waits for the one before it
+			const unsigned int start = first * ST7565_SEGMENT_WIDTH;
+			const unsigned int size  = (last + 1 - first) * ST7565_SEGMENT_WIDTH;
+			uint8_t           *page  = dma_page[dma_page_index];
+
+			// fill the spare buffer while the previous page is still going out
+			memcpy(page, pBuffer + start, size);
+			dma_page_index ^= 1u;
+
+			ST7565_WaitIdle();
+
+			SPI_ToggleMasterMode(&SPI0->CR, false);
+
+			ST7565_SelectColumnAndLine(4 + start, Line);
+
+			GPIO_SetBit(&GPIOB->DATA, GPIOB_PIN_ST7565_A0);
+
+			dma_buffer = page;
+			dma_column = 4 + start;
+			dma_line   = Line;
+			dma_size   = size;
+
+			ST7565_StartDma(page, size);
+
+			g_st7565_spi_bytes += size;
+		}
+		else
+	#endif
+	{
+		ST7565_SelectColumnAndLine(4 + (first * ST7565_SEGMENT_WIDTH), Line);
+
+		GPIO_SetBit(&GPIOB->DATA, GPIOB_PIN_ST7565_A0);
+
+		ST7565_WriteData(pBuffer + (first * ST7565_SEGMENT_WIDTH), (last + 1 - first) * ST7565_SEGMENT_WIDTH);
+	}
+
+	for (seg = first; seg <= last; seg++)
+		sent_hash[index][seg] = hash[seg];
+	force_segments[index] = 0;
+}
+
+void ST7565_Invalidate(void)
+{	// the next blits resend everything
+	memset(force_segments, 0xFF, sizeof(force_segments));
+}
+
+void ST7565_TimeSlice1s(void)
+{
+	g_st7565_spi_bytes_per_sec = g_st7565_spi_bytes - last_spi_bytes;
+	last_spi_bytes             = g_st7565_spi_bytes;
+}
+
 void ST7565_DrawLine(const unsigned int Column, const unsigned int Line, const unsigned int Size, const uint8_t *pBitmap)
 {
 	unsigned int i;
 
+	// written straight to the display, the blits have to resend those segments
+	if (Size > 0 && Column < LCD_WIDTH)
+	{
+		const unsigned int last = (Column + Size - 1) / ST7565_SEGMENT_WIDTH;
+		unsigned int       seg;
+		for (seg = Column / ST7565_SEGMENT_WIDTH; seg <= last && seg < ST7565_SEGMENTS; seg++)
+			force_segments[ST7565_HashIndex(Line)] |= 1u << seg;
+	}
+	g_st7565_spi_bytes += Size;
+
+	ST7565_WaitIdle();
+
 	SPI_ToggleMasterMode(&SPI0->CR, false);
 
 	ST7565_SelectColumnAndLine(Column + 4U, Line);
@@ -62,29 +290,29 @@ void ST7565_DrawLine(const unsigned int Column, const unsigned int Line, const u
 }
 
 void ST7565_BlitFullScreen(void)
-{
+{	// sends only what changed since the last blit
 	unsigned int Line;
 
+	ST7565_WaitIdle();
+
 	// reset some of the displays settings to try and overcome the
 	// radios hardware problem - RF corrupting the display
 	ST7565_Init(false);
 
+	// and every so often repaint the lot for the same reason
+	if (blits_to_refresh == 0)
+	{
+		blits_to_refresh = ST7565_REFRESH_EVERY;
+		ST7565_Invalidate();
+	}
+	blits_to_refresh--;
+
 	SPI_ToggleMasterMode(&SPI0->CR, false);
 
 	ST7565_WriteByte(0x40);
 
 	for (Line = 0; Line < ARRAY_SIZE(g_frame_buffer); Line++)
-	{
-		unsigned int Column;
-		ST7565_SelectColumnAndLine(4, Line + 1);
-		GPIO_SetBit(&GPIOB->DATA, GPIOB_PIN_ST7565_A0);
-		for (Column = 0; Column < ARRAY_SIZE(g_frame_buffer[0]); Column++)
-		{
-			while ((SPI0->FIFOST & SPI_FIFOST_TFF_MASK) != SPI_FIFOST_TFF_BITS_NOT_FULL) {}
-			SPI0->WDR = g_frame_buffer[Line][Column];
-		}
-		SPI_WaitForUndocumentedTxFifoStatusBit();
-	}
+		ST7565_SendPage(Line + 1, g_frame_buffer[Line]);
 
 	#if 0
 		// whats the delay for, it holds things up :(
@@ -93,41 +321,38 @@ void ST7565_BlitFullScreen(void)
 //		SYSTEM_DelayMs(1);
 	#endif
 
-	SPI_ToggleMasterMode(&SPI0->CR, true);
+	if (!ST7565_IsBusy())
+		SPI_ToggleMasterMode(&SPI0->CR, true);   // else released when the last page is out
 }
 
 void ST7565_BlitStatusLine(void)
 {	// the top small text line on the display
 
-	unsigned int i;
+	ST7565_WaitIdle();
 
 	SPI_ToggleMasterMode(&SPI0->CR, false);
 
 	ST7565_WriteByte(0x40);    // start line ?
 
-	ST7565_SelectColumnAndLine(4, 0);
-
-	GPIO_SetBit(&GPIOB->DATA, GPIOB_PIN_ST7565_A0);
-
-	for (i = 0; i < ARRAY_SIZE(g_status_line); i++)
-	{
-		while ((SPI0->FIFOST & SPI_FIFOST_TFF_MASK) != SPI_FIFOST_TFF_BITS_NOT_FULL) {}
-		SPI0->WDR = g_status_line[i];
-	}
-
-	SPI_WaitForUndocumentedTxFifoStatusBit();
+	ST7565_SendPage(0, g_status_line);
 
-	SPI_ToggleMasterMode(&SPI0->CR, true);
+	if (!ST7565_IsBusy())
+		SPI_ToggleMasterMode(&SPI0->CR, true);
 }
 
 void ST7565_FillScreen(const uint8_t Value)
 {
 	unsigned int i;
 
+	ST7565_WaitIdle();
+
 	// reset some of the displays settings to try and overcome the
 	// radios hardware problem - RF corrupting the display
 	ST7565_Init(false);
 
+	ST7565_Invalidate();
+	g_st7565_spi_bytes += 8 * 132;
+
 	SPI_ToggleMasterMode(&SPI0->CR, false);
 
 	for (i = 0; i < 8; i++)
@@ -148,6 +373,8 @@ void ST7565_FillScreen(const uint8_t Value)
 
 void ST7565_Init(const bool full)
 {
+	ST7565_WaitIdle();
+
 	if (full)
 	{
 		SPI0_Init();
@@ -219,6 +446,7 @@ void ST7565_SelectColumnAndLine(const uint8_t Column, const uint8_t Line)
 {
 	GPIO_ClearBit(&GPIOB->DATA, GPIOB_PIN_ST7565_A0);
 	while ((SPI0->FIFOST & SPI_FIFOST_TFF_MASK) != SPI_FIFOST_TFF_BITS_NOT_FULL) {}
+	g_st7565_spi_bytes += 3;
 	SPI0->WDR = Line + 176;
 	while ((SPI0->FIFOST & SPI_FIFOST_TFF_MASK) != SPI_FIFOST_TFF_BITS_NOT_FULL) {}
 	SPI0->WDR = ((Column >> 4) & 0x0F) | 0x10;
@@ -232,6 +460,7 @@ void ST7565_WriteByte(const uint8_t Value)
 	GPIO_ClearBit(&GPIOB->DATA, GPIOB_PIN_ST7565_A0);
 	while ((SPI0->FIFOST & SPI_FIFOST_TFF_MASK) != SPI_FIFOST_TFF_BITS_NOT_FULL) {}
 	SPI0->WDR = Value;
+	g_st7565_spi_bytes++;
 }
 
 void ST7565_SetContrast(const uint8_t value)
@@ -23,15 +23,27 @@
 #define LCD_WIDTH       128
 #define LCD_HEIGHT       64
 
+// dirty tracking granularity, a changed segment is resent whole
+#define ST7565_SEGMENTS         8
+#define ST7565_SEGMENT_WIDTH    (LCD_WIDTH / ST7565_SEGMENTS)
+#define ST7565_REFRESH_EVERY    32     // blits between forced full refreshes (RF can corrupt the display)
+
 extern uint8_t g_status_line[128];
 extern uint8_t g_frame_buffer[7][128];
 
+extern uint32_t g_st7565_spi_bytes;            // running total of bytes sent to the display
+extern uint16_t g_st7565_spi_bytes_per_sec;    // over the last whole second
+
 void    ST7565_DrawLine(const unsigned int Column, const unsigned int Line, const unsigned int Size, const uint8_t *pBitmap);
 void    ST7565_BlitFullScreen(void);
 void    ST7565_BlitStatusLine(void);
 void    ST7565_FillScreen(const uint8_t Value);
+bool    ST7565_IsBusy(void);
+void    ST7565_Invalidate(void);
+void    ST7565_TimeSlice1s(void);
 void    ST7565_Init(const bool full);
 void    ST7565_HardwareReset(void);
+// raw writes, the caller must make sure ST7565_IsBusy() is false first
 void    ST7565_SelectColumnAndLine(const uint8_t Column, const uint8_t Line);
 void    ST7565_WriteByte(const uint8_t Value);
 void    ST7565_SetContrast(const uint8_t value);
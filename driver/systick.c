@@ -43,3 +43,22 @@ void SYSTICK_DelayUs(uint32_t Delay)
 	} while (i < ticks);
 }
 
+uint32_t SYSTICK_GetTick(void)
+{	// SysTick clocks counted up from the 10ms interrupts plus the down counter, wraps every ~89 seconds
+	// interrupts must be enabled, a reload is only seen once the 10ms interrupt has counted it
+	const uint32_t reload = SysTick->LOAD + 1;
+	uint32_t       count;
+	uint32_t       value;
+
+	do {
+		count = g_global_sys_tick_counter;
+		value = SysTick->VAL;
+	} while (count != g_global_sys_tick_counter);
+
+	return (count * reload) + (reload - 1 - value);
+}
+
+uint32_t SYSTICK_GetElapsedUs(const uint32_t start_tick)
+{	// good for intervals up to the ~89 second wrap of SYSTICK_GetTick()
+	return (SYSTICK_GetTick() - start_tick) / gTickMultiplier;
+}
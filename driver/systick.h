@@ -21,6 +21,8 @@
 
 void SYSTICK_Init(void);
 void SYSTICK_DelayUs(uint32_t Delay);
+uint32_t SYSTICK_GetTick(void);
+uint32_t SYSTICK_GetElapsedUs(const uint32_t start_tick);
 
 #endif
 
@@ -479,7 +479,7 @@ const uint8_t g_font_small[95][6] =
 	};
 #endif
 
-#ifdef ENABLE_SPECTRUM
+#ifdef ENABLE_PANADAPTER
 	const uint8_t g_font3x5[160][3] =
 	{
 		{0x00, 0x00, 0x00}, //  32 - space
@@ -27,6 +27,9 @@ extern const uint8_t     g_font_small[95][6];
 #ifdef ENABLE_SMALL_BOLD
 	extern const uint8_t g_font_small_bold[95][6];
 #endif
+#ifdef ENABLE_PANADAPTER
+	extern const uint8_t g_font3x5[160][3];
+#endif
 
 #endif
 
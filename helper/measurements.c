@@ -0,0 +1,77 @@
+/* Copyright 2023 fagci
+ * https://github.com/fagci
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#include "helper/measurements.h"
+
+#ifndef ARRAY_SIZE
+	#define ARRAY_SIZE(arr) (sizeof(arr)/sizeof((arr)[0]))
+#endif
+
+// S0 .. S9 thresholds in -dBm, S9+10 and up follow
+static const uint8_t rssi_s_map[] = {121, 115, 109, 103, 97, 91, 85, 79, 73, 63};
+
+int32_t Clamp(int32_t v, int32_t min, int32_t max)
+{
+	return (v <= min) ? min : (v >= max) ? max : v;
+}
+
+int32_t ConvertDomain(int32_t aValue, int32_t aMin, int32_t aMax, int32_t bMin, int32_t bMax)
+{	// linearly map aValue from the a range onto the b range, rounded
+	const int32_t aRange = aMax - aMin;
+	const int32_t bRange = bMax - bMin;
+
+	if (aRange <= 0)
+		return bMin;
+
+	aValue = Clamp(aValue, aMin, aMax);
+	return (((aValue - aMin) * bRange) + (aRange / 2)) / aRange + bMin;
+}
+
+uint16_t Mid(const uint16_t *array, uint8_t n)
+{	// average
+	uint32_t     sum = 0;
+	unsigned int i;
+
+	if (n == 0)
+		return 0;
+
+	for (i = 0; i < n; i++)
+		sum += array[i];
+
+	return sum / n;
+}
+
+int16_t Rssi2DBm(uint16_t rssi)
+{	// BK4819 RSSI is in 0.5dB steps with a -160dBm offset
+	return (int16_t)(rssi >> 1) - 160;
+}
+
+uint8_t Rssi2PX(uint16_t rssi, uint8_t pxMin, uint8_t pxMax)
+{	// -150dBm .. -30dBm across the pixel range
+	return ConvertDomain(Rssi2DBm(rssi), -150, -30, pxMin, pxMax);
+}
+
+uint8_t DBm2S(int16_t dbm)
+{
+	unsigned int i;
+
+	dbm = -dbm;
+	for (i = 0; i < ARRAY_SIZE(rssi_s_map); i++)
+		if (dbm >= rssi_s_map[i])
+			return i;
+
+	return i;
+}
@@ -0,0 +1,29 @@
+/* Copyright 2023 fagci
+ * https://github.com/fagci
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#ifndef HELPER_MEASUREMENTS_H
+#define HELPER_MEASUREMENTS_H
+
+#include <stdint.h>
+
+int32_t  Clamp(int32_t v, int32_t min, int32_t max);
+int32_t  ConvertDomain(int32_t aValue, int32_t aMin, int32_t aMax, int32_t bMin, int32_t bMax);
+uint16_t Mid(const uint16_t *array, uint8_t n);
+int16_t  Rssi2DBm(uint16_t rssi);
+uint8_t  Rssi2PX(uint16_t rssi, uint8_t pxMin, uint8_t pxMax);
+uint8_t  DBm2S(int16_t dbm);
+
+#endif
@@ -25,7 +25,17 @@ const uint8_t         fm_resume_countdown_500ms        =  2500 / 500;  // 2.5 se
 const uint8_t         fm_radio_countdown_500ms         =  2000 / 500;  // 2 seconds
 const uint16_t        fm_play_countdown_scan_10ms      =   100 / 10;   // 100ms
 const uint16_t        fm_play_countdown_noscan_10ms    =  1200 / 10;   // 1.2 seconds
+const uint16_t        fm_seek_poll_10ms                =    20 / 10;   // 20ms
+const uint16_t        fm_seek_timeout_10ms             =  5000 / 10;   // 5 seconds
 const uint16_t        fm_restore_countdown_10ms        =  5000 / 10;   // 5 seconds
+#ifdef ENABLE_FM_WATCH
+	const uint16_t    fm_watch_window_10ms             =    60 / 10;   // 60ms
+	const uint16_t    fm_watch_sleep_10ms              =   240 / 10;   // 240ms
+#endif
+const uint8_t         bk1080_osc_settle_10ms           =   250 / 10;   // 250ms
+const uint8_t         bk1080_calibrate_10ms            =    60 / 10;   // 60ms
+const uint8_t         bk1080_tune_10ms                 =    20 / 10;   // 20ms, so at least 10ms between the two channel writes
+const uint8_t         bk1080_stc_timeout_10ms          =   100 / 10;   // 100ms, longest wait for STC to follow TUNE/SEEK before a seek
 
 const uint8_t         menu_timeout_500ms               =  30000 / 500;  // 30 seconds
 const uint16_t        menu_timeout_long_500ms          = 120000 / 500;  // 2 minutes
@@ -46,6 +56,7 @@ const uint8_t         key_repeat_10ms                  =    80 / 10;   // 80ms
 
 const uint16_t        scan_freq_css_timeout_10ms       = 10000 / 10;   // 10 seconds
 const uint8_t         scan_freq_css_delay_10ms         =   210 / 10;   // 210ms .. don't reduce this
+const uint16_t        scan_freq_strong_rssi            = (160 - 80) * 2; // -80dBm
 
 const uint16_t        dual_watch_count_after_tx_10ms   =  3600 / 10;   // 3.6 sec after TX ends
 const uint16_t        dual_watch_count_after_rx_10ms   =  1000 / 10;   // 1 sec after RX ends ?
@@ -64,6 +75,29 @@ const uint16_t        scan_pause_delay_in_4_10ms       =   300 / 10;   // 300ms
 const uint16_t        scan_pause_delay_in_5_10ms       =  1000 / 10;   // 1 sec
 const uint16_t        scan_pause_delay_in_6_10ms       =   100 / 10;   // 100ms
 const uint16_t        scan_pause_delay_in_7_10ms       =  3600 / 10;   // 3.6 seconds
+#ifdef ENABLE_FASTER_CHANNEL_SCAN
+	const uint16_t    scan_dwell_check_10ms            =    20 / 10;   // 20ms .. PLL settled, RSSI/noise readings are valid
+	const uint16_t    scan_dwell_full_10ms             =    90 / 10;   // 90ms .. <= ~60ms it misses signals (squelch response and/or PLL lock time) ?
+#endif
+#ifdef ENABLE_SCAN_RANGES
+	const uint16_t    scan_sweep_dwell_10ms            =    20 / 10;   // 20ms .. fast retune only, long enough for the PLL and RSSI to settle
+#endif
+#ifdef ENABLE_PRIORITY_LOOKBACK
+	const uint16_t    priority_lookback_10ms           =  2000 / 10;   // 2 seconds between looks at the priority channels
+	const uint8_t     priority_lookback_dwell_ms       =     3;        // 3ms per priority channel
+#endif
+#if defined(ENABLE_PRIORITY_LOOKBACK) || defined(ENABLE_WATCH_SLOTS)
+	const uint16_t    temp_channel_hold_10ms           =  3000 / 10;   // 3 seconds of quiet on a priority/watch slot channel before going back to the users own
+#endif
+#ifdef ENABLE_SCAN_LOCKOUT
+	const uint16_t    scan_lockout_expire_500ms        = 900000 / 500; // 15 minutes .. 0 = the lockouts stay until power off
+#endif
+#ifdef ENABLE_WATCH_SLOTS
+	const uint8_t     watch_peek_dwell_ms              =     3;        // 3ms per memory watch slot
+	const uint8_t     watch_period_500ms               = 10000 / 500;  // 10 seconds per sampling rate period, activity fades by one each period
+#endif
+
+const uint8_t         gui_frame_interval_10ms          =    50 / 10;   // 50ms .. at most 20 frames a second, key presses are drawn straight away
 
 const uint16_t        battery_save_count_10ms          = 10000 / 10;   // 10 seconds
 
@@ -144,6 +178,13 @@ volatile uint16_t     g_dual_watch_count_down_10ms;
 volatile bool         g_dual_watch_count_down_expired = true;
 bool                  g_dual_watch_active;
 
+#ifdef ENABLE_PRIORITY_LOOKBACK
+	volatile bool     g_schedule_priority_lookback = true;
+	volatile uint16_t g_priority_lookback_count_down_10ms;
+	uint32_t          g_priority_gap_us;        // audio gap caused by the last look-back
+	uint32_t          g_priority_gap_max_us;    // worst audio gap seen
+#endif
+
 volatile uint8_t      g_serial_config_count_down_500ms;
 
 volatile bool         g_next_time_slice_500ms;
@@ -244,6 +285,7 @@ bool                  g_f_lock = false;
 
 uint8_t               g_show_chan_prefix;
 
+volatile uint32_t     g_global_sys_tick_counter;
 volatile bool         g_next_time_slice;
 volatile uint8_t      g_found_CDCSS_count_down_10ms;
 volatile uint8_t      g_found_CTCSS_count_down_10ms;
@@ -327,6 +369,68 @@ void NUMBER_ToDigits(uint32_t Value, char *pDigits)
 	pDigits[8] = 0;
 }
 
+// sprintf() replacements for the UI, each writes a NUL terminated string
+// straight into the callers buffer and returns a pointer to the NUL so
+// several can be chained
+
+char *NUMBER_UnsignedToString(char *pString, uint32_t Value, const unsigned int Width, const char Pad)
+{	// "%u", right aligned in at least Width chars padded with Pad (' ' or '0')
+	char         Digits[10];
+	unsigned int Length = 0;
+	unsigned int i;
+
+	do {
+		const uint32_t Result = Value / 10U;
+		Digits[Length++] = '0' + (Value - (Result * 10U));
+		Value = Result;
+	} while (Value > 0);
+
+	for (i = Length; i < Width; i++)
+		*pString++ = Pad;
+
+	while (Length > 0)
+		*pString++ = Digits[--Length];
+
+	*pString = 0;
+	return pString;
+}
+
+char *NUMBER_SignedToString(char *pString, const int32_t Value, const unsigned int Width)
+{	// "%*d", space padded, eg. dBm
+	const uint32_t Magnitude = (Value < 0) ? 0U - (uint32_t)Value : (uint32_t)Value;
+	unsigned int   Length    = (Value < 0) ? 2 : 1;
+	uint32_t       Scale;
+
+	for (Scale = Magnitude; Scale >= 10U; Scale /= 10U)
+		Length++;
+
+	for (; Length < Width; Length++)
+		*pString++ = ' ';
+
+	if (Value < 0)
+		*pString++ = '-';
+
+	return NUMBER_UnsignedToString(pString, Magnitude, 0, 0);
+}
+
+char *NUMBER_FixedToString(char *pString, const uint32_t Value, const unsigned int Width, const unsigned int Decimals)
+{	// "%0*u.%0*u" from a value with Decimals implied places, eg. 14550000 (3, 5) -> "145.50000", 812 (1, 2) -> "8.12"
+	uint32_t     Scale = 1;
+	unsigned int i;
+
+	for (i = 0; i < Decimals; i++)
+		Scale *= 10U;
+
+	pString = NUMBER_UnsignedToString(pString, Value / Scale, Width, '0');
+	if (Decimals > 0)
+	{
+		*pString++ = '.';
+		pString = NUMBER_UnsignedToString(pString, Value % Scale, Decimals, '0');
+	}
+
+	return pString;
+}
+
 int32_t NUMBER_AddWithWraparound(int32_t Base, int32_t Add, int32_t LowerLimit, int32_t UpperLimit)
 {
 	Base += Add;
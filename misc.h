@@ -105,7 +105,17 @@ extern const uint8_t         fm_resume_countdown_500ms;
 extern const uint8_t         fm_radio_countdown_500ms;
 extern const uint16_t        fm_play_countdown_scan_10ms;
 extern const uint16_t        fm_play_countdown_noscan_10ms;
+extern const uint16_t        fm_seek_poll_10ms;
+extern const uint16_t        fm_seek_timeout_10ms;
 extern const uint16_t        fm_restore_countdown_10ms;
+#ifdef ENABLE_FM_WATCH
+	extern const uint16_t    fm_watch_window_10ms;
+	extern const uint16_t    fm_watch_sleep_10ms;
+#endif
+extern const uint8_t         bk1080_osc_settle_10ms;
+extern const uint8_t         bk1080_calibrate_10ms;
+extern const uint8_t         bk1080_tune_10ms;
+extern const uint8_t         bk1080_stc_timeout_10ms;
 
 extern const uint8_t         menu_timeout_500ms;
 extern const uint16_t        menu_timeout_long_500ms;
@@ -126,6 +136,9 @@ extern const uint8_t         key_repeat_10ms;
 
 extern const uint16_t        scan_freq_css_timeout_10ms;
 extern const uint8_t         scan_freq_css_delay_10ms;
+extern const uint16_t        scan_freq_strong_rssi;
+
+extern const uint8_t         gui_frame_interval_10ms;
 
 extern const uint16_t        battery_save_count_10ms;
 
@@ -157,6 +170,27 @@ extern const uint16_t        scan_pause_delay_in_4_10ms;
 extern const uint16_t        scan_pause_delay_in_5_10ms;
 extern const uint16_t        scan_pause_delay_in_6_10ms;
 extern const uint16_t        scan_pause_delay_in_7_10ms;
+#ifdef ENABLE_FASTER_CHANNEL_SCAN
+	extern const uint16_t    scan_dwell_check_10ms;
+	extern const uint16_t    scan_dwell_full_10ms;
+#endif
+#ifdef ENABLE_SCAN_RANGES
+	extern const uint16_t    scan_sweep_dwell_10ms;
+#endif
+#ifdef ENABLE_PRIORITY_LOOKBACK
+	extern const uint16_t    priority_lookback_10ms;
+	extern const uint8_t     priority_lookback_dwell_ms;
+#endif
+#if defined(ENABLE_PRIORITY_LOOKBACK) || defined(ENABLE_WATCH_SLOTS)
+	extern const uint16_t    temp_channel_hold_10ms;
+#endif
+#ifdef ENABLE_SCAN_LOCKOUT
+	extern const uint16_t    scan_lockout_expire_500ms;
+#endif
+#ifdef ENABLE_WATCH_SLOTS
+	extern const uint8_t     watch_peek_dwell_ms;
+	extern const uint8_t     watch_period_500ms;
+#endif
 
 extern const uint8_t         g_mic_gain_dB_2[5];
 
@@ -221,6 +255,13 @@ extern volatile uint16_t     g_dual_watch_count_down_10ms;
 extern volatile bool         g_dual_watch_count_down_expired;
 extern bool                  g_dual_watch_active;
 
+#ifdef ENABLE_PRIORITY_LOOKBACK
+	extern volatile bool     g_schedule_priority_lookback;
+	extern volatile uint16_t g_priority_lookback_count_down_10ms;
+	extern uint32_t          g_priority_gap_us;
+	extern uint32_t          g_priority_gap_max_us;
+#endif
+
 extern volatile uint8_t      g_serial_config_count_down_500ms;
 
 extern volatile bool         g_next_time_slice_500ms;
@@ -311,6 +352,7 @@ extern uint8_t               g_fsk_wite_index;
 	extern bool              g_is_noaa_mode;
 	extern uint8_t           g_noaa_channel;
 #endif
+extern volatile uint32_t     g_global_sys_tick_counter;
 extern volatile bool         g_next_time_slice;
 extern bool                  g_update_display;
 extern bool                  g_f_lock;
@@ -340,6 +382,9 @@ unsigned int get_TX_VFO(void);
 unsigned int get_RX_VFO(void);
 void         NUMBER_Get(char *pDigits, uint32_t *pInteger);
 void         NUMBER_ToDigits(uint32_t Value, char *pDigits);
+char        *NUMBER_UnsignedToString(char *pString, uint32_t Value, const unsigned int Width, const char Pad);
+char        *NUMBER_SignedToString(char *pString, const int32_t Value, const unsigned int Width);
+char        *NUMBER_FixedToString(char *pString, const uint32_t Value, const unsigned int Width, const unsigned int Decimals);
 int32_t      NUMBER_AddWithWraparound(int32_t Base, int32_t Add, int32_t LowerLimit, int32_t UpperLimit);
 
 #endif
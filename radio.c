@@ -44,6 +44,10 @@ uint8_t         g_selected_code;
 step_setting_t  g_step_setting;
 vfo_state_t     g_vfo_state[2];
 
+// sorted user channel numbers in each scan list, kept in step with g_user_channel_attributes[]
+uint8_t         g_scan_list_channels[SCAN_LIST_NUM][USER_CHANNEL_LAST + 1];
+uint8_t         g_scan_list_count[SCAN_LIST_NUM];
+
 bool RADIO_CheckValidChannel(uint16_t Channel, bool bCheckScanList, uint8_t VFO)
 {	// return true if the channel appears valid
 
@@ -93,25 +97,102 @@ bool RADIO_CheckValidChannel(uint16_t Channel, bool bCheckScanList, uint8_t VFO)
 	return true;
 }
 
-uint8_t RADIO_FindNextChannel(uint8_t Channel, scan_state_dir_t Direction, bool bCheckScanList, uint8_t VFO)
-{
-	unsigned int i;
+static unsigned int RADIO_ScanListIndex(const unsigned int list, const uint8_t Channel)
+{	// binary search - returns the index of the first entry >= Channel
 
-	for (i = 0; i <= USER_CHANNEL_LAST; i++)
+	const uint8_t *chans = g_scan_list_channels[list];
+	unsigned int   lo    = 0;
+	unsigned int   hi    = g_scan_list_count[list];
+
+	while (lo < hi)
 	{
-		if (Channel == 0xFF)
-			Channel = USER_CHANNEL_LAST;
+		const unsigned int mid = (lo + hi) / 2;
+		if (chans[mid] < Channel)
+			lo = mid + 1;
 		else
-		if (Channel > USER_CHANNEL_LAST)
-			Channel = USER_CHANNEL_FIRST;
+			hi = mid;
+	}
+
+	return lo;
+}
+
+void RADIO_InitScanLists(void)
+{	// rebuild the sorted channel index arrays from scratch
+
+	unsigned int list;
+
+	for (list = 0; list < SCAN_LIST_NUM; list++)
+	{
+		unsigned int Channel;
+		unsigned int count = 0;
+
+		for (Channel = USER_CHANNEL_FIRST; Channel <= USER_CHANNEL_LAST; Channel++)
+			if (RADIO_CheckValidChannel(Channel, list != SCAN_LIST_ALL, list))
+				g_scan_list_channels[list][count++] = Channel;
+
+		g_scan_list_count[list] = count;
+	}
+}
+
+void RADIO_UpdateScanLists(const uint8_t Channel)
+{	// add/remove the one channel to/from each list, keeping them sorted
+
+	unsigned int list;
+
+	if (Channel > USER_CHANNEL_LAST)
+		return;
 
-		if (RADIO_CheckValidChannel(Channel, bCheckScanList, VFO))
-			return Channel;
+	for (list = 0; list < SCAN_LIST_NUM; list++)
+	{
+		uint8_t           *chans   = g_scan_list_channels[list];
+		const unsigned int count   = g_scan_list_count[list];
+		const unsigned int i       = RADIO_ScanListIndex(list, Channel);
+		const bool         present = (i < count && chans[i] == Channel);
+		const bool         valid   = RADIO_CheckValidChannel(Channel, list != SCAN_LIST_ALL, list);
 
-		Channel += Direction;
+		if (valid && !present)
+		{
+			memmove(&chans[i + 1], &chans[i], count - i);
+			chans[i] = Channel;
+			g_scan_list_count[list]++;
+		}
+		else
+		if (!valid && present)
+		{
+			memmove(&chans[i], &chans[i + 1], count - i - 1);
+			g_scan_list_count[list]--;
+		}
 	}
+}
+
+uint8_t RADIO_FindNextChannel(uint8_t Channel, scan_state_dir_t Direction, bool bCheckScanList, uint8_t VFO)
+{
+	const unsigned int list  = (bCheckScanList && VFO < SCAN_LIST_ALL) ? VFO : SCAN_LIST_ALL;
+	const uint8_t     *chans = g_scan_list_channels[list];
+	const unsigned int count = g_scan_list_count[list];
+	unsigned int       i;
+
+	if (count == 0)
+		return 0xFF;   // no valid channels
+
+	if (Channel == 0xFF)
+		Channel = USER_CHANNEL_LAST;
+	else
+	if (Channel > USER_CHANNEL_LAST)
+		Channel = USER_CHANNEL_FIRST;
+
+	i = RADIO_ScanListIndex(list, Channel);
+
+	if (i < count && chans[i] == Channel)
+		return Channel;
+
+	if (Direction == SCAN_OFF)
+		return 0xFF;
+
+	if (Direction == SCAN_REV)
+		return chans[(i > 0) ? i - 1 : count - 1];
 
-	return 0xFF;
+	return chans[(i < count) ? i : 0];
 }
 
 void RADIO_InitInfo(vfo_info_t *pInfo, const uint8_t ChannelSave, const uint32_t Frequency)
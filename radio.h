@@ -23,6 +23,7 @@
 #include "app/scanner.h"
 #include "dcs.h"
 #include "frequencies.h"
+#include "misc.h"
 
 enum {
 	USER_CH_BAND_MASK = 0x0F << 0,
@@ -36,6 +37,13 @@ enum {
 	RADIO_CHANNEL_DOWN = 0xFFu,
 };
 */
+enum {
+	SCAN_LIST_1 = 0,
+	SCAN_LIST_2,
+	SCAN_LIST_ALL,
+	SCAN_LIST_NUM
+};
+
 enum {
 	BANDWIDTH_WIDE = 0,
 	BANDWIDTH_NARROW
@@ -128,7 +136,12 @@ extern step_setting_t  g_step_setting;
 
 extern vfo_state_t     g_vfo_state[2];
 
+extern uint8_t         g_scan_list_channels[SCAN_LIST_NUM][USER_CHANNEL_LAST + 1];
+extern uint8_t         g_scan_list_count[SCAN_LIST_NUM];
+
 bool     RADIO_CheckValidChannel(uint16_t ChNum, bool bCheckScanList, uint8_t RadioNum);
+void     RADIO_InitScanLists(void);
+void     RADIO_UpdateScanLists(const uint8_t Channel);
 uint8_t  RADIO_FindNextChannel(uint8_t ChNum, scan_state_dir_t Direction, bool bCheckScanList, uint8_t RadioNum);
 void     RADIO_InitInfo(vfo_info_t *pInfo, const uint8_t ChannelSave, const uint32_t Frequency);
 void     RADIO_ConfigureChannel(const unsigned int VFO, const unsigned int configure);
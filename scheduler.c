@@ -41,8 +41,6 @@
 				flag = true;             \
 	} while (0)
 
-static volatile uint32_t g_global_sys_tick_counter;
-
 void SystickHandler(void);
 
 // we come here every 10ms
@@ -93,6 +91,12 @@ void SystickHandler(void)
 		if (g_current_function != FUNCTION_MONITOR && g_current_function != FUNCTION_TRANSMIT)
 			DECREMENT_AND_TRIGGER(g_scan_pause_delay_in_10ms, g_schedule_scan_listen);
 
+	#ifdef ENABLE_PRIORITY_LOOKBACK
+		if (g_css_scan_mode == CSS_SCAN_MODE_OFF)
+			if (g_current_function == FUNCTION_RECEIVE || (g_current_function == FUNCTION_FOREGROUND && g_scan_state_dir == SCAN_OFF))
+				DECREMENT_AND_TRIGGER(g_priority_lookback_count_down_10ms, g_schedule_priority_lookback);
+	#endif
+
 	DECREMENT_AND_TRIGGER(g_tail_tone_elimination_count_down_10ms, g_flag_tail_tone_elimination_complete);
 
 	#ifdef ENABLE_VOICE
@@ -170,7 +170,17 @@ void SETTINGS_SaveSettings(void)
 	State[4] = g_eeprom.scan_list_enabled[1];
 	State[5] = g_eeprom.scan_list_priority_ch1[1];
 	State[6] = g_eeprom.scan_list_priority_ch2[1];
-	State[7] = 0xFF;
+	#if defined(ENABLE_SCAN_RANGES) || defined(ENABLE_SCAN_ACTIVITY)
+		State[7] = 0;
+		#ifdef ENABLE_SCAN_RANGES
+			if (g_eeprom.scan_range_enable) State[7] |= 1u << 0;
+		#endif
+		#ifdef ENABLE_SCAN_ACTIVITY
+			if (g_eeprom.scan_active_first) State[7] |= 1u << 1;
+		#endif
+	#else
+		State[7] = 0xFF;
+	#endif
 	EEPROM_WriteBuffer(0x0F18, State);
 
 	memset(State, 0xFF, sizeof(State));
@@ -286,6 +296,8 @@ void SETTINGS_UpdateChannel(uint8_t Channel, const vfo_info_t *pVFO, bool keep)
 	EEPROM_WriteBuffer(Offset, State);
 	
 	g_user_channel_attributes[Channel] = Attributes;
+
+	RADIO_UpdateScanLists(Channel);
 	
 //	#ifndef ENABLE_KEEP_MEM_NAME
 		if (Channel <= USER_CHANNEL_LAST)
@@ -157,6 +157,12 @@ typedef struct {
 	bool                  scan_list_enabled[2];
 	uint8_t               scan_list_priority_ch1[2];
 	uint8_t               scan_list_priority_ch2[2];
+	#ifdef ENABLE_SCAN_RANGES
+		bool              scan_range_enable;
+	#endif
+	#ifdef ENABLE_SCAN_ACTIVITY
+		bool              scan_active_first;
+	#endif
 
 	uint8_t               field29_0x26;
 	uint8_t               field30_0x27;
@@ -39,6 +39,17 @@ void UI_DisplayFM(void)
 	strcpy(String, "FM");
 	UI_PrintString(String, 0, 127, 0, 12);
 
+	#ifdef ENABLE_FM_WATCH
+		if (g_fm_watch)
+		{	// last measured watch window to ham audio switchover
+			if (g_fm_watch_latency_10ms > 0)
+				sprintf(String, "WATCH %ums", g_fm_watch_latency_10ms * 10);
+			else
+				strcpy(String, "WATCH");
+			UI_PrintStringSmall(String, 0, 127, 6);
+		}
+	#endif
+
 	memset(String, 0, sizeof(String));
 	if (g_ask_to_save)
 	{
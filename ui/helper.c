@@ -19,6 +19,7 @@
 #include "driver/st7565.h"
 #include "external/printf/printf.h"
 #include "font.h"
+#include "misc.h"
 #include "ui/helper.h"
 #include "ui/inputbox.h"
 
@@ -32,7 +33,8 @@ void UI_GenerateChannelString(char *pString, const uint8_t Channel)
 
 	if (g_input_box_index == 0)
 	{
-		sprintf(pString, "CH-%02u", Channel + 1);
+		strcpy(pString, "CH-");
+		NUMBER_UnsignedToString(pString + 3, Channel + 1, 2, '0');
 		return;
 	}
 
@@ -54,12 +56,15 @@ void UI_GenerateChannelStringEx(char *pString, const bool bShowPrefix, const uin
 	}
 
 	if (bShowPrefix)
-		sprintf(pString, "CH-%03u", ChannelNumber + 1);
+	{
+		strcpy(pString, "CH-");
+		NUMBER_UnsignedToString(pString + 3, ChannelNumber + 1, 3, '0');
+	}
 	else
 	if (ChannelNumber == 0xFF)
 		strcpy(pString, "NULL");
 	else
-		sprintf(pString, "%03u", ChannelNumber + 1);
+		NUMBER_UnsignedToString(pString, ChannelNumber + 1, 3, '0');
 }
 
 void UI_PrintString(const char *pString, uint8_t Start, uint8_t End, uint8_t Line, uint8_t Width)
@@ -258,3 +263,45 @@ void UI_Displaysmall_digits(const uint8_t size, const char *str, const uint8_t x
 		}
 	}
 }
+
+#ifdef ENABLE_PANADAPTER
+	void UI_DrawPixel(const uint8_t x, const uint8_t y, const bool fill)
+	{
+		if (x >= 128 || y >= (8 * ARRAY_SIZE(g_frame_buffer)))
+			return;
+
+		if (fill)
+			g_frame_buffer[y >> 3][x] |=  (1u << (y & 7));
+		else
+			g_frame_buffer[y >> 3][x] &= ~(1u << (y & 7));
+	}
+
+	void UI_DrawVLine(const uint8_t sy, const uint8_t ey, const uint8_t x, const bool fill)
+	{
+		unsigned int y;
+		for (y = sy; y <= ey; y++)
+			UI_DrawPixel(x, y, fill);
+	}
+
+	void UI_PrintStringSmallest(const char *pString, uint8_t x, const uint8_t y, const bool fill)
+	{	// 3x5 font, x and y are in pixels
+		for ( ; *pString != 0; pString++, x += 4)
+		{
+			const unsigned int index = (uint8_t)*pString - 32;
+			unsigned int       i;
+
+			if (index >= ARRAY_SIZE(g_font3x5))
+				continue;
+
+			for (i = 0; i < ARRAY_SIZE(g_font3x5[0]); i++)
+			{
+				uint8_t      pixels = g_font3x5[index][i];
+				unsigned int j;
+
+				for (j = 0; pixels != 0; j++, pixels >>= 1)
+					if (pixels & 1u)
+						UI_DrawPixel(x + i, y + j, fill);
+			}
+		}
+	}
+#endif
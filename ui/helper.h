@@ -31,6 +31,11 @@ void UI_PrintStringSmallBuffer(const char *pString, uint8_t *buffer);
 void UI_DisplayFrequency(const char *pDigits, uint8_t X, uint8_t Y, bool bDisplayLeadingZero, bool flag);
 void UI_DisplayFrequencySmall(const char *pDigits, uint8_t X, uint8_t Y, bool bDisplayLeadingZero);
 void UI_Displaysmall_digits(const uint8_t size, const char *str, const uint8_t x, const uint8_t y, const bool display_leading_zeros);
+#ifdef ENABLE_PANADAPTER
+	void UI_DrawPixel(const uint8_t x, const uint8_t y, const bool fill);
+	void UI_DrawVLine(const uint8_t sy, const uint8_t ey, const uint8_t x, const bool fill);
+	void UI_PrintStringSmallest(const char *pString, uint8_t x, const uint8_t y, const bool fill);
+#endif
 
 #endif
 
@@ -44,6 +44,103 @@
 
 center_line_t center_line = CENTER_LINE_NONE;
 
+// ***************************************************************************
+// retained widgets .. each one remembers a signature of the values it last drew
+// and only clears and redraws its own patch of the frame buffer when they change
+
+enum widget_e {
+	WIDGET_MARKER = 0,    // VFO marker and the TX/RX symbol
+	WIDGET_CHANNEL,       // channel, VFO or NOAA number
+	WIDGET_FREQUENCY,     // frequency, channel name or VFO state
+	WIDGET_LEVEL,         // TX power/RX signal bars
+	WIDGET_FLAGS,         // CTCSS/DCS, power, offset, reverse, narrow, DTMF and scramble symbols
+	WIDGET_COUNT
+};
+
+typedef struct {
+	uint8_t line;         // first frame buffer line, relative to the VFO's first line
+	uint8_t lines;
+	uint8_t x;
+	uint8_t width;
+} widget_area_t;
+
+typedef struct {
+	uint32_t value;       // signature of the values last drawn
+	bool     valid;
+} widget_t;
+
+static const widget_area_t vfo_widget_area[WIDGET_COUNT] =
+{
+	{0, 1,  0,  31},
+	{1, 1,  0,  31},
+	{0, 2, 31,  97},
+	{2, 1,  0,  24},
+	{2, 1, 24, 104}
+};
+static const widget_area_t center_widget_area = {3, 1, 0, LCD_WIDTH};
+
+static widget_t vfo_widget[2][WIDGET_COUNT];
+static widget_t center_widget;
+static bool     main_drawn;   // false when the frame buffer holds some other screen
+
+static uint32_t UI_Signature(const uint32_t signature, const uint32_t value)
+{
+	return (signature * 33u) + value;
+}
+
+static uint32_t UI_StringSignature(uint32_t signature, const char *str)
+{
+	while (*str)
+		signature = UI_Signature(signature, (uint8_t)*str++);
+	return signature;
+}
+
+static bool UI_UpdateWidget(widget_t *pWidget, const widget_area_t *pArea, const unsigned int line, const uint32_t value)
+{	// true if the widget has to be drawn, its area of the frame buffer is cleared ready
+	unsigned int i;
+
+	if (pWidget->valid && pWidget->value == value)
+		return false;
+
+	pWidget->value = value;
+	pWidget->valid = true;
+
+	for (i = 0; i < pArea->lines; i++)
+		memset(g_frame_buffer[line + pArea->line + i] + pArea->x, 0, pArea->width);
+
+	return true;
+}
+
+static bool UI_UpdateCenterLine(const center_line_t type, const uint32_t value)
+{
+	if (!main_drawn)
+		return false;   // the frame buffer holds some other screen
+	return UI_UpdateWidget(&center_widget, &center_widget_area, 0, UI_Signature(type, value));
+}
+
+static void UI_DrawChangedColumns(const unsigned int line, const uint8_t *pNew, const uint8_t *pOld, const unsigned int width)
+{	// send just the span of columns that differ from what was there before
+	unsigned int first = 0;
+	unsigned int last  = width;
+
+	while (first < width && pNew[first] == pOld[first])
+		first++;
+	if (first >= width)
+		return;     // nothing changed
+
+	while (pNew[last - 1] == pOld[last - 1])
+		last--;
+
+	ST7565_DrawLine(first, line + 1, last - first, pNew + first);
+}
+
+void UI_MainInvalidate(void)
+{	// the next UI_DisplayMain() starts again from a blank frame buffer
+	memset(vfo_widget, 0, sizeof(vfo_widget));
+	center_widget.valid = false;
+	main_drawn          = false;
+}
+
 // ***************************************************************************
 
 #ifdef ENABLE_SHOW_TX_TIMEOUT
@@ -80,11 +177,12 @@ center_line_t center_line = CENTER_LINE_NONE;
 			uint8_t           *p_line    = g_frame_buffer[line];
 			unsigned int       i;
 			char               s[16];
-			
-			if (now)
-				memset(p_line, 0, LCD_WIDTH);
 
-			sprintf(s, "TX %u", secs);
+			if (!UI_UpdateCenterLine(CENTER_LINE_TX_TIMEOUT, UI_Signature(secs, len)))
+				return true;    // already showing
+
+			strcpy(s, "TX ");
+			NUMBER_UnsignedToString(s + 3, secs, 0, 0);
 			UI_PrintStringSmall(s, 2, 0, line);
 
 			#if 1
@@ -164,7 +262,10 @@ void UI_drawBars(uint8_t *p, const unsigned int level)
 
 			#if defined(ENABLE_ALARM) || defined(ENABLE_TX1750)
 				if (g_alarm_state != ALARM_STATE_OFF)
+				{
+					UI_UpdateCenterLine(CENTER_LINE_NONE, 0);
 					return;
+				}
 			#endif
 
 			{
@@ -194,7 +295,8 @@ void UI_drawBars(uint8_t *p, const unsigned int level)
 
 				uint8_t *p_line = g_frame_buffer[line];
 
-				memset(p_line, 0, LCD_WIDTH);
+				if (!UI_UpdateCenterLine(CENTER_LINE_AUDIO_BAR, len))
+					return;
 
 				#if 1
 					// solid bar
@@ -237,6 +339,7 @@ void UI_drawBars(uint8_t *p, const unsigned int level)
 
 		const unsigned int line         = 3;
 		uint8_t           *p_line        = g_frame_buffer[line];
+		uint8_t            prev_line[LCD_WIDTH];
 
 		char               s[16];
 		unsigned int       i;
@@ -250,18 +353,26 @@ void UI_drawBars(uint8_t *p, const unsigned int level)
 			return;     // display is in use
 
 		if (now)
-			memset(p_line, 0, LCD_WIDTH);
+			memmove(prev_line, p_line, LCD_WIDTH);
+
+		if (!UI_UpdateCenterLine(CENTER_LINE_RSSI, UI_Signature(rssi_dBm, len)))
+			return;     // no visible change
 
 		if (rssi_dBm >= (s9_dBm + 6))
 		{	// S9+XXdB, 1dB increment
-			const char *fmt[] = {"%3d 9+%u  ", "%3d 9+%2u "};
 			const unsigned int s9_dB = ((rssi_dBm - s9_dBm) <= 99) ? rssi_dBm - s9_dBm : 99;
-			sprintf(s, (s9_dB < 10) ? fmt[0] : fmt[1], rssi_dBm, s9_dB);
+			char              *p     = NUMBER_SignedToString(s, rssi_dBm, 3);
+			strcpy(p, " 9+");
+			p = NUMBER_UnsignedToString(p + 3, s9_dB, 0, 0);
+			strcpy(p, (s9_dB < 10) ? "  " : " ");
 		}
 		else
 		{	// S0 ~ S9, 6dB per S-point
 			const unsigned int s_level = (rssi_dBm >= s0_dBm) ? (rssi_dBm - s0_dBm) / 6 : 0;
-			sprintf(s, "%4d S%u ", rssi_dBm, s_level);
+			char              *p       = NUMBER_SignedToString(s, rssi_dBm, 4);
+			strcpy(p, " S");
+			p = NUMBER_UnsignedToString(p + 2, s_level, 0, 0);
+			strcpy(p, " ");
 		}
 		UI_PrintStringSmall(s, 2, 0, line);
 
@@ -276,7 +387,7 @@ void UI_drawBars(uint8_t *p, const unsigned int level)
 		#endif
 
 		if (now)
-			ST7565_BlitFullScreen();
+			UI_DrawChangedColumns(line, p_line, prev_line, LCD_WIDTH);
 	}
 #endif
 
@@ -361,16 +472,20 @@ void UI_UpdateRSSI(const int16_t rssi, const int vfo)
 
 		p_line = g_frame_buffer[Line - 1];
 
-		memset(p_line, 0, 23);
-
-		// untested !!!
+		{
+			uint8_t prev_bars[23];
 
-		if (rssi_level == 0)
-			p_line = NULL;
-		else
+			memmove(prev_bars, p_line, sizeof(prev_bars));
+			memset(p_line, 0, sizeof(prev_bars));
 			UI_drawBars(p_line, rssi_level);
 
-		ST7565_DrawLine(0, Line, 23, p_line);
+			// only the bars that came or went
+			UI_DrawChangedColumns(Line - 1, p_line, prev_bars, sizeof(prev_bars));
+		}
+
+		// what the level widget now shows
+		vfo_widget[vfo][WIDGET_LEVEL].value = rssi_level;
+		vfo_widget[vfo][WIDGET_LEVEL].valid = true;
 	#endif
 }
 
@@ -391,11 +506,10 @@ void UI_DisplayMain(void)
 		const bool single_vfo = false;
 //	#endif
 
-	// clear the screen
-	memset(g_frame_buffer, 0, sizeof(g_frame_buffer));
-
 	if (g_serial_config_count_down_500ms > 0)
 	{
+		UI_MainInvalidate();
+		memset(g_frame_buffer, 0, sizeof(g_frame_buffer));
 		backlight_turn_on();
 		UI_PrintString("UART", 0, LCD_WIDTH, 1, 8);
 		UI_PrintString("CONFIG COMMS", 0, LCD_WIDTH, 3, 8);
@@ -405,6 +519,8 @@ void UI_DisplayMain(void)
 	
 	if (g_eeprom.key_lock && g_keypad_locked > 0)
 	{	// tell user how to unlock the keyboard
+		UI_MainInvalidate();
+		memset(g_frame_buffer, 0, sizeof(g_frame_buffer));
 		backlight_turn_on();
 		UI_PrintString("Long press #", 0, LCD_WIDTH, 1, 8);
 		UI_PrintString("to unlock",    0, LCD_WIDTH, 3, 8);
@@ -412,6 +528,13 @@ void UI_DisplayMain(void)
 		return;
 	}
 
+	if (!main_drawn)
+	{	// clear the screen, every widget is drawn afresh
+		UI_MainInvalidate();
+		memset(g_frame_buffer, 0, sizeof(g_frame_buffer));
+		main_drawn = true;
+	}
+
 	for (vfo_num = 0; vfo_num < 2; vfo_num++)
 	{
 		const unsigned int line       = (vfo_num == 0) ? line0 : line1;
@@ -420,7 +543,10 @@ void UI_DisplayMain(void)
 		const bool         same_vfo   = (channel == vfo_num) ? true : false;
 		uint8_t           *p_line0    = g_frame_buffer[line + 0];
 		uint8_t           *p_line1    = g_frame_buffer[line + 1];
+		widget_t          *widget     = vfo_widget[vfo_num];
 		unsigned int       mode       = 0;
+		unsigned int       marker     = 0;   // 1 = selected VFO, 2 = the other VFO in use
+		unsigned int       symbol     = 0;   // 1 = TX, 2 = RX
 		unsigned int       state;
 
 		if (single_vfo)
@@ -438,10 +564,14 @@ void UI_DisplayMain(void)
 		if (channel != vfo_num)
 		{
 			if (g_dtmf_call_state != DTMF_CALL_STATE_NONE || g_dtmf_is_tx || g_dtmf_input_mode)
-			{	// show DTMF stuff
+			{	// show DTMF stuff .. not retained, it takes over the VFO's lines and the center line
 
 				char Contact[16];
 
+				memset(g_frame_buffer[vfo_num * 3], 0, sizeof(g_frame_buffer[0]) * 4);
+				memset(widget, 0, sizeof(vfo_widget[0]));
+				center_widget.valid = false;
+
 				if (!g_dtmf_input_mode)
 				{
 					memset(Contact, 0, sizeof(Contact));
@@ -481,19 +611,19 @@ void UI_DisplayMain(void)
 
 			// highlight the selected/used VFO with a marker
 			if (!single_vfo && same_vfo)
-				memmove(p_line0 + 0, BITMAP_VFO_DEFAULT, sizeof(BITMAP_VFO_DEFAULT));
+				marker = 1;
 			else
 			if (g_eeprom.cross_vfo_rx_tx != CROSS_BAND_OFF)
-				memmove(p_line0 + 0, BITMAP_VFO_NOT_DEFAULT, sizeof(BITMAP_VFO_NOT_DEFAULT));
+				marker = 2;
 		}
 		else
 		if (!single_vfo)
 		{	// highlight the selected/used VFO with a marker
 			if (same_vfo)
-				memmove(p_line0 + 0, BITMAP_VFO_DEFAULT, sizeof(BITMAP_VFO_DEFAULT));
+				marker = 1;
 			else
 			//if (g_eeprom.cross_vfo_rx_tx != CROSS_BAND_OFF)
-				memmove(p_line0 + 0, BITMAP_VFO_NOT_DEFAULT, sizeof(BITMAP_VFO_NOT_DEFAULT));
+				marker = 2;
 		}
 
 		if (g_current_function == FUNCTION_TRANSMIT)
@@ -508,12 +638,8 @@ void UI_DisplayMain(void)
 				channel = (g_eeprom.cross_vfo_rx_tx == CROSS_BAND_OFF) ? g_eeprom.rx_vfo : g_eeprom.tx_vfo;
 				if (channel == vfo_num)
 				{	// show the TX symbol
-					mode = 1;
-					#ifdef ENABLE_SMALL_BOLD
-						UI_PrintStringSmallBold("TX", 14, 0, line);
-					#else
-						UI_PrintStringSmall("TX", 14, 0, line);
-					#endif
+					mode   = 1;
+					symbol = 1;
 				}
 			}
 		}
@@ -524,49 +650,72 @@ void UI_DisplayMain(void)
 			     g_current_function == FUNCTION_MONITOR ||
 			     g_current_function == FUNCTION_INCOMING) &&
 			     g_eeprom.rx_vfo == vfo_num)
+			{
+				symbol = 2;
+			}
+		}
+
+		if (UI_UpdateWidget(&widget[WIDGET_MARKER], &vfo_widget_area[WIDGET_MARKER], line, UI_Signature(marker, symbol)))
+		{
+			if (marker == 1)
+				memmove(p_line0 + 0, BITMAP_VFO_DEFAULT, sizeof(BITMAP_VFO_DEFAULT));
+			else
+			if (marker == 2)
+				memmove(p_line0 + 0, BITMAP_VFO_NOT_DEFAULT, sizeof(BITMAP_VFO_NOT_DEFAULT));
+
+			if (symbol != 0)
 			{
 				#ifdef ENABLE_SMALL_BOLD
-					UI_PrintStringSmallBold("RX", 14, 0, line);
+					UI_PrintStringSmallBold((symbol == 1) ? "TX" : "RX", 14, 0, line);
 				#else
-					UI_PrintStringSmall("RX", 14, 0, line);
+					UI_PrintStringSmall((symbol == 1) ? "TX" : "RX", 14, 0, line);
 				#endif
 			}
 		}
 
-		if (g_eeprom.screen_channel[vfo_num] <= USER_CHANNEL_LAST)
-		{	// channel mode
-			const unsigned int x = 2;
-			const bool inputting = (g_input_box_index == 0 || g_eeprom.tx_vfo != vfo_num) ? false : true;
-			if (!inputting)
-				NUMBER_ToDigits(g_eeprom.screen_channel[vfo_num] + 1, String);  // show the memory channel number
-			else
-				memmove(String + 5, g_input_box, 3);                            // show the input text
-			UI_PrintStringSmall("M", x, 0, line + 1);
-			UI_Displaysmall_digits(3, String + 5, x + 7, line + 1, inputting);
-		}
-		else
-		if (IS_FREQ_CHANNEL(g_eeprom.screen_channel[vfo_num]))
-		{	// frequency mode
-			// show the frequency band number
-			const unsigned int x = 2;	// was 14
-//			sprintf(String, "FB%u", 1 + g_eeprom.screen_channel[vfo_num] - FREQ_CHANNEL_FIRST);
-			sprintf(String, "VFO%u", 1 + g_eeprom.screen_channel[vfo_num] - FREQ_CHANNEL_FIRST);
-			UI_PrintStringSmall(String, x, 0, line + 1);
-		}
-		#ifdef ENABLE_NOAA
-			else
+		{	// show the channel number
+			const bool     inputting = (g_input_box_index == 0 || g_eeprom.tx_vfo != vfo_num) ? false : true;
+			const uint32_t input     = inputting ? (g_input_box[0] | (g_input_box[1] << 8) | (g_input_box[2] << 16)) : 0;
+
+			if (UI_UpdateWidget(&widget[WIDGET_CHANNEL], &vfo_widget_area[WIDGET_CHANNEL], line, UI_Signature(UI_Signature(g_eeprom.screen_channel[vfo_num], inputting), input)))
 			{
-				if (g_input_box_index == 0 || g_eeprom.tx_vfo != vfo_num)
-				{	// channel number
-					sprintf(String, "N%u", 1 + g_eeprom.screen_channel[vfo_num] - NOAA_CHANNEL_FIRST);
+				if (g_eeprom.screen_channel[vfo_num] <= USER_CHANNEL_LAST)
+				{	// channel mode
+					const unsigned int x = 2;
+					if (!inputting)
+						NUMBER_ToDigits(g_eeprom.screen_channel[vfo_num] + 1, String);  // show the memory channel number
+					else
+						memmove(String + 5, g_input_box, 3);                            // show the input text
+					UI_PrintStringSmall("M", x, 0, line + 1);
+					UI_Displaysmall_digits(3, String + 5, x + 7, line + 1, inputting);
 				}
 				else
-				{	// user entering channel number
-					sprintf(String, "N%u%u", '0' + g_input_box[0], '0' + g_input_box[1]);
+				if (IS_FREQ_CHANNEL(g_eeprom.screen_channel[vfo_num]))
+				{	// frequency mode
+					// show the frequency band number
+					const unsigned int x = 2;	// was 14
+//					sprintf(String, "FB%u", 1 + g_eeprom.screen_channel[vfo_num] - FREQ_CHANNEL_FIRST);
+					strcpy(String, "VFO");
+					NUMBER_UnsignedToString(String + 3, 1 + g_eeprom.screen_channel[vfo_num] - FREQ_CHANNEL_FIRST, 0, 0);
+					UI_PrintStringSmall(String, x, 0, line + 1);
 				}
-				UI_PrintStringSmall(String, 7, 0, line + 1);
+				#ifdef ENABLE_NOAA
+					else
+					{
+						if (!inputting)
+						{	// channel number
+							String[0] = 'N';
+							NUMBER_UnsignedToString(String + 1, 1 + g_eeprom.screen_channel[vfo_num] - NOAA_CHANNEL_FIRST, 0, 0);
+						}
+						else
+						{	// user entering channel number
+							sprintf(String, "N%u%u", '0' + g_input_box[0], '0' + g_input_box[1]);
+						}
+						UI_PrintStringSmall(String, 7, 0, line + 1);
+					}
+				#endif
 			}
-		#endif
+		}
 
 		// ************
 
@@ -581,22 +730,11 @@ void UI_DisplayMain(void)
 			}
 		#endif
 
-		if (state != VFO_STATE_NORMAL)
 		{
-			const char *state_list[] = {"", "BUSY", "BAT LOW", "TX DISABLE", "TIMEOUT", "ALARM", "VOLT HIGH"};
-			if (state < ARRAY_SIZE(state_list))
-				UI_PrintString(state_list[state], 31, 0, line, 8);
-		}
-		else
-		if (g_input_box_index > 0 && IS_FREQ_CHANNEL(g_eeprom.screen_channel[vfo_num]) && g_eeprom.tx_vfo == vfo_num)
-		{	// user entering a frequency
-			UI_DisplayFrequency(g_input_box, 32, line, true, false);
+			const bool entering  = (g_input_box_index > 0 && IS_FREQ_CHANNEL(g_eeprom.screen_channel[vfo_num]) && g_eeprom.tx_vfo == vfo_num) ? true : false;
+			uint32_t   frequency = g_eeprom.vfo_info[vfo_num].pRX->frequency;
+			uint32_t   value;
 
-//			center_line = CENTER_LINE_IN_USE;
-		}
-		else
-		{
-			uint32_t frequency = g_eeprom.vfo_info[vfo_num].pRX->frequency;
 			if (g_current_function == FUNCTION_TRANSMIT)
 			{	// transmitting
 				channel = (g_eeprom.cross_vfo_rx_tx == CROSS_BAND_OFF) ? g_eeprom.rx_vfo : g_eeprom.tx_vfo;
@@ -604,101 +742,138 @@ void UI_DisplayMain(void)
 					frequency = g_eeprom.vfo_info[vfo_num].pTX->frequency;
 			}
 
-			if (g_eeprom.screen_channel[vfo_num] <= USER_CHANNEL_LAST)
-			{	// it's a channel
-
-				// show the channel symbols
-				const uint8_t attributes = g_user_channel_attributes[g_eeprom.screen_channel[vfo_num]];
-				if (attributes & USER_CH_SCANLIST1)
-					memmove(p_line0 + 113, BITMAP_SCANLIST1, sizeof(BITMAP_SCANLIST1));
-				if (attributes & USER_CH_SCANLIST2)
-					memmove(p_line0 + 120, BITMAP_SCANLIST2, sizeof(BITMAP_SCANLIST2));
-				#ifndef ENABLE_BIG_FREQ
-					if ((attributes & USER_CH_COMPAND) > 0)
-						memmove(p_line0 + 120 + LCD_WIDTH, BITMAP_COMPAND, sizeof(BITMAP_COMPAND));
-				#else
-
-					// TODO:  // find somewhere else to put the symbol
-
-				#endif
-
-				#pragma GCC diagnostic push
-				#pragma GCC diagnostic ignored "-Wimplicit-fallthrough="
+			// the channel name isn't part of the signature, it can only be
+			// edited from the menu which redraws everything on the way back
+			value = UI_Signature(state, entering);
+			if (state == VFO_STATE_NORMAL && entering)
+			{
+				unsigned int i;
+				for (i = 0; i < sizeof(g_input_box); i++)
+					value = UI_Signature(value, g_input_box[i]);
+			}
+			else
+			if (state == VFO_STATE_NORMAL)
+			{
+				value = UI_Signature(value, frequency);
+				value = UI_Signature(value, g_eeprom.screen_channel[vfo_num]);
+				value = UI_Signature(value, g_user_channel_attributes[g_eeprom.screen_channel[vfo_num]]);
+				value = UI_Signature(value, g_eeprom.channel_display_mode);
+			}
 
-				switch (g_eeprom.channel_display_mode)
+			if (UI_UpdateWidget(&widget[WIDGET_FREQUENCY], &vfo_widget_area[WIDGET_FREQUENCY], line, value))
+			{
+				if (state != VFO_STATE_NORMAL)
 				{
-					case MDF_FREQUENCY:	// show the channel frequency
-						#ifdef ENABLE_BIG_FREQ
-							NUMBER_ToDigits(frequency, String);
-							// show the main large frequency digits
-							UI_DisplayFrequency(String, 32, line, false, false);
-							// show the remaining 2 small frequency digits
-							UI_Displaysmall_digits(2, String + 6, 113, line + 1, true);
-						#else
-							// show the frequency in the main font
-							sprintf(String, "%03u.%05u", frequency / 100000, frequency % 100000);
-							UI_PrintString(String, 32, 0, line, 8);
-						#endif
-						break;
+					const char *state_list[] = {"", "BUSY", "BAT LOW", "TX DISABLE", "TIMEOUT", "ALARM", "VOLT HIGH"};
+					if (state < ARRAY_SIZE(state_list))
+						UI_PrintString(state_list[state], 31, 0, line, 8);
+				}
+				else
+				if (entering)
+				{	// user entering a frequency
+					UI_DisplayFrequency(g_input_box, 32, line, true, false);
 
-					case MDF_CHANNEL:	// show the channel number
-						sprintf(String, "CH-%03u", g_eeprom.screen_channel[vfo_num] + 1);
-						UI_PrintString(String, 32, 0, line, 8);
-						break;
+//					center_line = CENTER_LINE_IN_USE;
+				}
+				else
+				if (g_eeprom.screen_channel[vfo_num] <= USER_CHANNEL_LAST)
+				{	// it's a channel
+
+					// show the channel symbols
+					const uint8_t attributes = g_user_channel_attributes[g_eeprom.screen_channel[vfo_num]];
+					if (attributes & USER_CH_SCANLIST1)
+						memmove(p_line0 + 113, BITMAP_SCANLIST1, sizeof(BITMAP_SCANLIST1));
+					if (attributes & USER_CH_SCANLIST2)
+						memmove(p_line0 + 120, BITMAP_SCANLIST2, sizeof(BITMAP_SCANLIST2));
+					#ifndef ENABLE_BIG_FREQ
+						if ((attributes & USER_CH_COMPAND) > 0)
+							memmove(p_line0 + 120 + LCD_WIDTH, BITMAP_COMPAND, sizeof(BITMAP_COMPAND));
+					#else
 
-					case MDF_NAME:		// show the channel name
-					case MDF_NAME_FREQ:	// show the channel name and frequency
+						// TODO:  // find somewhere else to put the symbol
 
-						BOARD_fetchChannelName(String, g_eeprom.screen_channel[vfo_num]);
-						if (String[0] == 0)
-						{	// no channel name, show the channel number instead
-							sprintf(String, "CH-%03u", g_eeprom.screen_channel[vfo_num] + 1);
-						}
+					#endif
 
-						if (g_eeprom.channel_display_mode == MDF_NAME)
-						{
-							UI_PrintString(String, 32, 0, line, 8);
-						}
-						else
-						{
-							#ifdef ENABLE_SMALL_BOLD
-								UI_PrintStringSmallBold(String, 32 + 4, 0, line);
+					#pragma GCC diagnostic push
+					#pragma GCC diagnostic ignored "-Wimplicit-fallthrough="
+
+					switch (g_eeprom.channel_display_mode)
+					{
+						case MDF_FREQUENCY:	// show the channel frequency
+							#ifdef ENABLE_BIG_FREQ
+								NUMBER_ToDigits(frequency, String);
+								// show the main large frequency digits
+								UI_DisplayFrequency(String, 32, line, false, false);
+								// show the remaining 2 small frequency digits
+								UI_Displaysmall_digits(2, String + 6, 113, line + 1, true);
 							#else
-								UI_PrintStringSmall(String, 32 + 4, 0, line);
+								// show the frequency in the main font
+								NUMBER_FixedToString(String, frequency, 3, 5);
+								UI_PrintString(String, 32, 0, line, 8);
 							#endif
+							break;
 
-							// show the channel frequency below the channel number/name
-							sprintf(String, "%03u.%05u", frequency / 100000, frequency % 100000);
-							UI_PrintStringSmall(String, 32 + 4, 0, line + 1);
-						}
-
-						break;
+						case MDF_CHANNEL:	// show the channel number
+							strcpy(String, "CH-");
+							NUMBER_UnsignedToString(String + 3, g_eeprom.screen_channel[vfo_num] + 1, 3, '0');
+							UI_PrintString(String, 32, 0, line, 8);
+							break;
+
+						case MDF_NAME:		// show the channel name
+						case MDF_NAME_FREQ:	// show the channel name and frequency
+
+							BOARD_fetchChannelName(String, g_eeprom.screen_channel[vfo_num]);
+							if (String[0] == 0)
+							{	// no channel name, show the channel number instead
+								strcpy(String, "CH-");
+								NUMBER_UnsignedToString(String + 3, g_eeprom.screen_channel[vfo_num] + 1, 3, '0');
+							}
+
+							if (g_eeprom.channel_display_mode == MDF_NAME)
+							{
+								UI_PrintString(String, 32, 0, line, 8);
+							}
+							else
+							{
+								#ifdef ENABLE_SMALL_BOLD
+									UI_PrintStringSmallBold(String, 32 + 4, 0, line);
+								#else
+									UI_PrintStringSmall(String, 32 + 4, 0, line);
+								#endif
+
+								// show the channel frequency below the channel number/name
+								NUMBER_FixedToString(String, frequency, 3, 5);
+								UI_PrintStringSmall(String, 32 + 4, 0, line + 1);
+							}
+
+							break;
+					}
+
+					#pragma GCC diagnostic pop
 				}
-
-				#pragma GCC diagnostic pop
-			}
-			else
-			{	// frequency mode
-				#ifdef ENABLE_BIG_FREQ
-					NUMBER_ToDigits(frequency, String);  // 8 digits
-					// show the main large frequency digits
-					UI_DisplayFrequency(String, 32, line, false, false);
-					// show the remaining 2 small frequency digits
-					UI_Displaysmall_digits(2, String + 6, 113, line + 1, true);
-				#else
-					// show the frequency in the main font
-					sprintf(String, "%03u.%05u", frequency / 100000, frequency % 100000);
-					UI_PrintString(String, 32, 0, line, 8);
-				#endif
-
-				// show the channel symbols
-				const uint8_t attributes = g_user_channel_attributes[g_eeprom.screen_channel[vfo_num]];
-				if ((attributes & USER_CH_COMPAND) > 0)
+				else
+				{	// frequency mode
 					#ifdef ENABLE_BIG_FREQ
-						memmove(p_line0 + 120, BITMAP_COMPAND, sizeof(BITMAP_COMPAND));
+						NUMBER_ToDigits(frequency, String);  // 8 digits
+						// show the main large frequency digits
+						UI_DisplayFrequency(String, 32, line, false, false);
+						// show the remaining 2 small frequency digits
+						UI_Displaysmall_digits(2, String + 6, 113, line + 1, true);
 					#else
-						memmove(p_line0 + 120 + LCD_WIDTH, BITMAP_COMPAND, sizeof(BITMAP_COMPAND));
+						// show the frequency in the main font
+						NUMBER_FixedToString(String, frequency, 3, 5);
+						UI_PrintString(String, 32, 0, line, 8);
 					#endif
+
+					// show the channel symbols
+					const uint8_t attributes = g_user_channel_attributes[g_eeprom.screen_channel[vfo_num]];
+					if ((attributes & USER_CH_COMPAND) > 0)
+						#ifdef ENABLE_BIG_FREQ
+							memmove(p_line0 + 120, BITMAP_COMPAND, sizeof(BITMAP_COMPAND));
+						#else
+							memmove(p_line0 + 120 + LCD_WIDTH, BITMAP_COMPAND, sizeof(BITMAP_COMPAND));
+						#endif
+				}
 			}
 		}
 
@@ -726,65 +901,79 @@ void UI_DisplayMain(void)
 				#endif
 			}
 
-			UI_drawBars(p_line1 + LCD_WIDTH, Level);
+			if (UI_UpdateWidget(&widget[WIDGET_LEVEL], &vfo_widget_area[WIDGET_LEVEL], line, Level))
+				UI_drawBars(p_line1 + LCD_WIDTH, Level);
 		}
 
 		// ************
 
-		String[0] = '\0';
-		if (g_eeprom.vfo_info[vfo_num].am_mode)
-		{	// show the AM symbol
-			strcpy(String, "AM");
-		}
-		else
-		{	// or show the CTCSS/DCS symbol
-			const freq_config_t *pConfig = (mode == 1) ? g_eeprom.vfo_info[vfo_num].pTX : g_eeprom.vfo_info[vfo_num].pRX;
-			const unsigned int code_type = pConfig->code_type;
-			const char *code_list[] = {"", "CT", "DCS", "DCR"};
-			if (code_type < ARRAY_SIZE(code_list))
-				strcpy(String, code_list[code_type]);
-		}
-		UI_PrintStringSmall(String, LCD_WIDTH + 24, 0, line + 1);
-
-		if (state == VFO_STATE_NORMAL || state == VFO_STATE_ALARM)
-		{	// show the TX power
-			const char pwr_list[] = "LMH";
-			const unsigned int i = g_eeprom.vfo_info[vfo_num].output_power;
-			String[0] = (i < ARRAY_SIZE(pwr_list)) ? pwr_list[i] : '\0';
-			String[1] = '\0';
-			UI_PrintStringSmall(String, LCD_WIDTH + 46, 0, line + 1);
-		}
+		{	// the symbols along the bottom of the VFO
+			const vfo_info_t    *pInfo     = &g_eeprom.vfo_info[vfo_num];
+			const freq_config_t *pConfig   = (mode == 1) ? pInfo->pTX : pInfo->pRX;
+			const bool           show_pwr  = (state == VFO_STATE_NORMAL || state == VFO_STATE_ALARM) ? true : false;
+			const bool           offset    = (pInfo->freq_config_rx.frequency != pInfo->freq_config_tx.frequency) ? true : false;
+			const bool           dtmf      = (pInfo->dtmf_decoding_enable || g_setting_killed) ? true : false;
+			const bool           scramble  = (pInfo->scrambling_type > 0 && g_setting_scramble_enable) ? true : false;
+			uint32_t             value;
+
+			value = UI_Signature(pInfo->am_mode, pInfo->am_mode ? 0 : pConfig->code_type);
+			value = UI_Signature(value, show_pwr ? pInfo->output_power + 1 : 0);
+			value = UI_Signature(value, offset ? pInfo->tx_offset_freq_dir + 1 : 0);
+			value = UI_Signature(value, pInfo->frequency_reverse);
+			value = UI_Signature(value, pInfo->channel_bandwidth);
+			value = UI_Signature(value, (dtmf ? 1u : 0u) | (scramble ? 2u : 0u));
+
+			if (UI_UpdateWidget(&widget[WIDGET_FLAGS], &vfo_widget_area[WIDGET_FLAGS], line, value))
+			{
+				String[0] = '\0';
+				if (pInfo->am_mode)
+				{	// show the AM symbol
+					strcpy(String, "AM");
+				}
+				else
+				{	// or show the CTCSS/DCS symbol
+					const unsigned int code_type = pConfig->code_type;
+					const char *code_list[] = {"", "CT", "DCS", "DCR"};
+					if (code_type < ARRAY_SIZE(code_list))
+						strcpy(String, code_list[code_type]);
+				}
+				UI_PrintStringSmall(String, LCD_WIDTH + 24, 0, line + 1);
+
+				if (show_pwr)
+				{	// show the TX power
+					const char pwr_list[] = "LMH";
+					const unsigned int i = pInfo->output_power;
+					String[0] = (i < ARRAY_SIZE(pwr_list)) ? pwr_list[i] : '\0';
+					String[1] = '\0';
+					UI_PrintStringSmall(String, LCD_WIDTH + 46, 0, line + 1);
+				}
 
-		if (g_eeprom.vfo_info[vfo_num].freq_config_rx.frequency != g_eeprom.vfo_info[vfo_num].freq_config_tx.frequency)
-		{	// show the TX offset symbol
-			const char dir_list[] = "\0+-";
-			const unsigned int i = g_eeprom.vfo_info[vfo_num].tx_offset_freq_dir;
-			String[0] = (i < sizeof(dir_list)) ? dir_list[i] : '?';
-			String[1] = '\0';
-			UI_PrintStringSmall(String, LCD_WIDTH + 54, 0, line + 1);
-		}
+				if (offset)
+				{	// show the TX offset symbol
+					const char dir_list[] = "\0+-";
+					const unsigned int i = pInfo->tx_offset_freq_dir;
+					String[0] = (i < sizeof(dir_list)) ? dir_list[i] : '?';
+					String[1] = '\0';
+					UI_PrintStringSmall(String, LCD_WIDTH + 54, 0, line + 1);
+				}
 
-		// show the TX/RX reverse symbol
-		if (g_eeprom.vfo_info[vfo_num].frequency_reverse)
-			UI_PrintStringSmall("R", LCD_WIDTH + 62, 0, line + 1);
+				// show the TX/RX reverse symbol
+				if (pInfo->frequency_reverse)
+					UI_PrintStringSmall("R", LCD_WIDTH + 62, 0, line + 1);
 
-		{	// show the narrow band symbol
-			String[0] = '\0';
-			if (g_eeprom.vfo_info[vfo_num].channel_bandwidth == BANDWIDTH_NARROW)
-			{
-				String[0] = 'N';
-				String[1] = '\0';
-			}
-			UI_PrintStringSmall(String, LCD_WIDTH + 70, 0, line + 1);
-		}
+				// show the narrow band symbol
+				if (pInfo->channel_bandwidth == BANDWIDTH_NARROW)
+					UI_PrintStringSmall("N", LCD_WIDTH + 70, 0, line + 1);
 
-		// show the DTMF decoding symbol
-		if (g_eeprom.vfo_info[vfo_num].dtmf_decoding_enable || g_setting_killed)
-			UI_PrintStringSmall("DTMF", LCD_WIDTH + 78, 0, line + 1);
+				// show the DTMF decoding symbol
+				if (dtmf)
+					UI_PrintStringSmall("DTMF", LCD_WIDTH + 78, 0, line + 1);
 
-		// show the audio scramble symbol
-		if (g_eeprom.vfo_info[vfo_num].scrambling_type > 0 && g_setting_scramble_enable)
-			UI_PrintStringSmall("SCR", LCD_WIDTH + 106, 0, line + 1);
+				// show the audio scramble symbol
+				if (scramble)
+					UI_PrintStringSmall("SCR", LCD_WIDTH + 106, 0, line + 1);
+			}
+		}
 	}
 
 	if (center_line == CENTER_LINE_NONE)
@@ -822,7 +1011,8 @@ void UI_DisplayMain(void)
 
 				center_line = CENTER_LINE_AM_FIX_DATA;
 				AM_fix_print_data(g_eeprom.rx_vfo, String);
-				UI_PrintStringSmall(String, 2, 0, 3);
+				if (UI_UpdateCenterLine(center_line, UI_StringSignature(0, String)))
+					UI_PrintStringSmall(String, 2, 0, 3);
 			}
 			else
 		#endif
@@ -852,7 +1042,8 @@ void UI_DisplayMain(void)
 
 					strcpy(String, "DTMF ");
 					strcat(String, g_dtmf_rx_live + idx);
-					UI_PrintStringSmall(String, 2, 0, 3);
+					if (UI_UpdateCenterLine(center_line, UI_StringSignature(0, String)))
+						UI_PrintStringSmall(String, 2, 0, 3);
 				}
 			#else
 				if (g_setting_live_dtmf_decoder && g_dtmf_rx_index > 0)
@@ -867,7 +1058,8 @@ void UI_DisplayMain(void)
 
 					strcpy(String, "DTMF ");
 					strcat(String, g_dtmf_rx + idx);
-					UI_PrintStringSmall(String, 2, 0, 3);
+					if (UI_UpdateCenterLine(center_line, UI_StringSignature(0, String)))
+						UI_PrintStringSmall(String, 2, 0, 3);
 				}
 			#endif
 
@@ -880,13 +1072,20 @@ void UI_DisplayMain(void)
 
 					center_line = CENTER_LINE_CHARGE_DATA;
 
-					sprintf(String, "Charge %u.%02uV %u%%",
-						g_battery_voltage_average / 100, g_battery_voltage_average % 100,
-						BATTERY_VoltsToPercent(g_battery_voltage_average));
-					UI_PrintStringSmall(String, 2, 0, 3);
+					char *p;
+					strcpy(String, "Charge ");
+					p = NUMBER_FixedToString(String + 7, g_battery_voltage_average, 1, 2);
+					strcpy(p, "V ");
+					p = NUMBER_UnsignedToString(p + 2, BATTERY_VoltsToPercent(g_battery_voltage_average), 0, 0);
+					strcpy(p, "%");
+					if (UI_UpdateCenterLine(center_line, UI_StringSignature(0, String)))
+						UI_PrintStringSmall(String, 2, 0, 3);
 				}
 			#endif
 		}
+
+		if (center_line == CENTER_LINE_NONE)
+			UI_UpdateCenterLine(CENTER_LINE_NONE, 0);    // nothing to show, blank it
 	}
 
 	ST7565_BlitFullScreen();
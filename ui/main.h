@@ -38,6 +38,7 @@ extern center_line_t center_line;
 	void UI_DisplayAudioBar(void);
 #endif
 void UI_UpdateRSSI(const int16_t rssi, const int vfo);
+void UI_MainInvalidate(void);
 void UI_DisplayMain(void);
 
 #endif
@@ -76,6 +76,12 @@ const t_menu_item g_menu_list[] =
 	{"VOICE",  VOICE_ID_VOICE_PROMPT,                  MENU_VOICE         },
 #endif
 	{"SC REV", VOICE_ID_INVALID,                       MENU_SC_REV        }, // was "SC_REV"
+#ifdef ENABLE_SCAN_RANGES
+	{"SC RNG", VOICE_ID_INVALID,                       MENU_SC_RNG        },
+#endif
+#ifdef ENABLE_SCAN_ACTIVITY
+	{"SC ACT", VOICE_ID_INVALID,                       MENU_SC_ACT        },
+#endif
 	{"KEYLOC", VOICE_ID_INVALID,                       MENU_AUTOLK        }, // was "AUTOLk"
 	{"S ADD1", VOICE_ID_INVALID,                       MENU_S_ADD1        },
 	{"S ADD2", VOICE_ID_INVALID,                       MENU_S_ADD2        },
@@ -458,7 +464,11 @@ void UI_DisplayMenu(void)
 			memmove(g_frame_buffer[0] + (8 * menu_list_width) + 1, BITMAP_CurrentIndicator, sizeof(BITMAP_CurrentIndicator));
 
 		// draw the menu index number/count
-		sprintf(String, "%2u.%u", 1 + g_menu_cursor, g_menu_list_count);
+		{
+			char *p = NUMBER_UnsignedToString(String, 1 + g_menu_cursor, 2, ' ');
+			*p++ = '.';
+			NUMBER_UnsignedToString(p, g_menu_list_count, 0, 0);
+		}
 		UI_PrintStringSmall(String, 2, 0, 6);
 
 	#else
@@ -497,7 +507,11 @@ void UI_DisplayMenu(void)
 			}
 
 			// draw the menu index number/count
-			sprintf(String, "%2u.%u", 1 + g_menu_cursor, g_menu_list_count);
+			{
+				char *p = NUMBER_UnsignedToString(String, 1 + g_menu_cursor, 2, ' ');
+				*p++ = '.';
+				NUMBER_UnsignedToString(p, g_menu_list_count, 0, 0);
+			}
 			UI_PrintStringSmall(String, 2, 0, 6);
 		}
 		else
@@ -523,13 +537,14 @@ void UI_DisplayMenu(void)
 	switch (g_menu_cursor)
 	{
 		case MENU_SQL:
-			sprintf(String, "%d", g_sub_menu_selection);
+			NUMBER_SignedToString(String, g_sub_menu_selection, 0);
 			break;
 
 		case MENU_MIC:
 			{	// display the mic gain in actual dB rather than just an index number
 				const uint8_t mic = g_mic_gain_dB_2[g_sub_menu_selection];
-				sprintf(String, "+%u.%01udB", mic / 2, mic % 2);
+				String[0] = '+';
+				strcpy(NUMBER_FixedToString(String + 1, (mic / 2) * 10 + (mic % 2), 1, 1), "dB");
 			}
 			break;
 
@@ -540,7 +555,7 @@ void UI_DisplayMenu(void)
 		#endif
 
 		case MENU_STEP:
-			sprintf(String, "%d.%02ukHz", STEP_FREQ_TABLE[g_sub_menu_selection] / 100, STEP_FREQ_TABLE[g_sub_menu_selection] % 100);
+			strcpy(NUMBER_FixedToString(String, STEP_FREQ_TABLE[g_sub_menu_selection], 1, 2), "kHz");
 			break;
 
 		case MENU_TXP:
@@ -579,7 +594,7 @@ void UI_DisplayMenu(void)
 				}
 				else
 				{
-					sprintf(String, "%u.%uHz", CTCSS_OPTIONS[g_sub_menu_selection - 1] / 10, CTCSS_OPTIONS[g_sub_menu_selection - 1] % 10);
+					strcpy(NUMBER_FixedToString(String, CTCSS_OPTIONS[g_sub_menu_selection - 1], 1, 1), "Hz");
 
 					pConfig->code_type = CODE_TYPE_CONTINUOUS_TONE;
 					Code = g_sub_menu_selection - 1;
@@ -591,7 +606,7 @@ void UI_DisplayMenu(void)
 				if (g_sub_menu_selection == 0)
 					strcpy(String, "OFF");
 				else
-					sprintf(String, "%u.%uHz", CTCSS_OPTIONS[g_sub_menu_selection - 1] / 10, CTCSS_OPTIONS[g_sub_menu_selection - 1] % 10);
+					strcpy(NUMBER_FixedToString(String, CTCSS_OPTIONS[g_sub_menu_selection - 1], 1, 1), "Hz");
 			#endif
 
 			break;
@@ -648,7 +663,7 @@ void UI_DisplayMenu(void)
 				if (g_sub_menu_selection == 0)
 					strcpy(String, "OFF");
 				else
-					sprintf(String, "%d", g_sub_menu_selection);
+					NUMBER_SignedToString(String, g_sub_menu_selection, 0);
 				break;
 		#endif
 
@@ -683,7 +698,7 @@ void UI_DisplayMenu(void)
 
 		case MENU_CONTRAST:
 			strcpy(String, "DISPLAY\nCONTRAST\n");
-			sprintf(String, "%d", g_sub_menu_selection);
+			NUMBER_SignedToString(String, g_sub_menu_selection, 0);
 			//g_setting_contrast = g_sub_menu_selection
 			ST7565_SetContrast(g_sub_menu_selection);
 			g_update_display = true;
@@ -764,7 +779,8 @@ void UI_DisplayMenu(void)
 			if (valid && !g_ask_for_confirmation)
 			{	// show the frequency so that the user knows the channels frequency
 				const uint32_t frequency = BOARD_fetchChannelFrequency(g_sub_menu_selection);
-				sprintf(String + strlen(String), "\n%u.%05u", frequency / 100000, frequency % 100000);
+				strcat(String, "\n");
+				NUMBER_FixedToString(String + strlen(String), frequency, 1, 5);
 			}
 
 			break;
@@ -798,7 +814,7 @@ void UI_DisplayMenu(void)
 
 				if (!g_ask_for_confirmation)
 				{	// show the frequency so that the user knows the channels frequency
-					sprintf(String, "%u.%05u", frequency / 100000, frequency % 100000);
+					NUMBER_FixedToString(String, frequency, 1, 5);
 					if (!g_is_in_sub_menu || g_edit_index < 0)
 						UI_PrintString(String, menu_item_x1, menu_item_x2, y + 4, 8);
 					else
@@ -838,6 +854,20 @@ void UI_DisplayMenu(void)
 			strcat(String, g_sub_menu_sc_rev[g_sub_menu_selection]);
 			break;
 
+		#ifdef ENABLE_SCAN_RANGES
+			case MENU_SC_RNG:
+				strcpy(String, "SCAN\nRANGE\n");
+				strcat(String, g_sub_menu_off_on[g_sub_menu_selection]);
+				break;
+		#endif
+
+		#ifdef ENABLE_SCAN_ACTIVITY
+			case MENU_SC_ACT:
+				strcpy(String, "ACTIVE\nFIRST\n");
+				strcat(String, g_sub_menu_off_on[g_sub_menu_selection]);
+				break;
+		#endif
+
 		case MENU_MDF:
 			strcpy(String, g_sub_menu_mdf[g_sub_menu_selection]);
 			break;
@@ -846,12 +876,15 @@ void UI_DisplayMenu(void)
 			if (g_sub_menu_selection == 0)
 				strcpy(String, "OFF");
 			else
-				sprintf(String, "%d*100ms", g_sub_menu_selection);
+				strcpy(NUMBER_SignedToString(String, g_sub_menu_selection, 0), "*100ms");
 			break;
 
 		case MENU_S_LIST:
 			if (g_sub_menu_selection < 2)
-				sprintf(String, "LIST%u", 1 + g_sub_menu_selection);
+			{
+				strcpy(String, "LIST");
+				NUMBER_UnsignedToString(String + 4, 1 + g_sub_menu_selection, 0, 0);
+			}
 			else
 				strcpy(String, "ALL");
 			break;
@@ -905,7 +938,7 @@ void UI_DisplayMenu(void)
 
 			strcpy(String, "DTMF MSG\n");
 			if (g_sub_menu_selection < DTMF_HOLD_MAX)
-				sprintf(String + strlen(String), "%d sec", g_sub_menu_selection);
+				strcpy(NUMBER_SignedToString(String + strlen(String), g_sub_menu_selection, 0), " sec");
 			else
 				strcat(String, "STAY ON\nSCREEN");  // 60
 
@@ -914,7 +947,7 @@ void UI_DisplayMenu(void)
 		case MENU_D_PRE:
 			strcpy(String, "TX DTMF\nDELAY\n");
 //			sprintf(String + strlen(String), "%d*10ms", g_sub_menu_selection);
-			sprintf(String + strlen(String), "%dms", 10 * g_sub_menu_selection);
+			strcpy(NUMBER_SignedToString(String + strlen(String), 10 * g_sub_menu_selection, 0), "ms");
 			break;
 
 		case MENU_PTT_ID:
@@ -952,11 +985,14 @@ void UI_DisplayMenu(void)
 			break;
 
 		case MENU_VOL:
-			sprintf(String, "%u.%02uV\n%u%%\ncurr %u",
-				g_battery_voltage_average / 100, g_battery_voltage_average % 100,
-				BATTERY_VoltsToPercent(g_battery_voltage_average),
-				g_usb_current);
+		{
+			char *p = NUMBER_FixedToString(String, g_battery_voltage_average, 1, 2);
+			strcpy(p, "V\n");
+			p = NUMBER_UnsignedToString(p + 2, BATTERY_VoltsToPercent(g_battery_voltage_average), 0, 0);
+			strcpy(p, "%\ncurr ");
+			NUMBER_UnsignedToString(p + 7, g_usb_current, 0, 0);
 			break;
+		}
 
 		case MENU_SIDE1_SHORT:
 		case MENU_SIDE1_LONG:
@@ -991,7 +1027,9 @@ void UI_DisplayMenu(void)
 		case MENU_BATCAL:
 		{
 			const uint16_t vol = (uint32_t)g_battery_voltage_average * g_battery_calibration[3] / g_sub_menu_selection;
-			sprintf(String, "%u.%02uV\n%u", vol / 100, vol % 100, g_sub_menu_selection);
+			char          *p   = NUMBER_FixedToString(String, vol, 1, 2);
+			strcpy(p, "V\n");
+			NUMBER_UnsignedToString(p + 2, g_sub_menu_selection, 0, 0);
 			break;
 		}
 	}
@@ -1087,13 +1125,15 @@ void UI_DisplayMenu(void)
 
 			if (IS_USER_CHANNEL(g_eeprom.scan_list_priority_ch1[i]))
 			{
-				sprintf(String, "PRI1:%u", g_eeprom.scan_list_priority_ch1[i] + 1);
+				strcpy(String, "PRI1:");
+				NUMBER_UnsignedToString(String + 5, g_eeprom.scan_list_priority_ch1[i] + 1, 0, 0);
 				UI_PrintString(String, menu_item_x1, menu_item_x2, 3, 8);
 			}
 
 			if (IS_USER_CHANNEL(g_eeprom.scan_list_priority_ch2[i]))
 			{
-				sprintf(String, "PRI2:%u", g_eeprom.scan_list_priority_ch2[i] + 1);
+				strcpy(String, "PRI2:");
+				NUMBER_UnsignedToString(String + 5, g_eeprom.scan_list_priority_ch2[i] + 1, 0, 0);
 				UI_PrintString(String, menu_item_x1, menu_item_x2, 5, 8);
 			}
 		}
@@ -71,6 +71,12 @@ enum
 	MENU_VOICE,
 #endif
 	MENU_SC_REV,
+#ifdef ENABLE_SCAN_RANGES
+	MENU_SC_RNG,
+#endif
+#ifdef ENABLE_SCAN_ACTIVITY
+	MENU_SC_ACT,
+#endif
 	MENU_AUTOLK,
 	MENU_S_ADD1,
 	MENU_S_ADD2,
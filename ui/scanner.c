@@ -115,6 +115,32 @@ void UI_DisplayScanner(void)
 
 	UI_PrintString(String, 2, 0, 3, 8);
 
+	// ***********************************
+	// time-to-lock line
+
+	if (g_scan_freq_lock_10ms > 0 || g_scan_css_lock_10ms > 0)
+	{	// both times clamped to 99.99s, "F 99.99s C 99.99s" is the longest
+		char Lock[20];
+		char *p = Lock;
+		if (g_scan_freq_lock_10ms > 0)
+		{
+			*p++ = 'F';
+			*p++ = ' ';
+			p = NUMBER_FixedToString(p, (g_scan_freq_lock_10ms < 9999) ? g_scan_freq_lock_10ms : 9999, 1, 2);
+			*p++ = 's';
+			*p++ = ' ';
+		}
+		if (g_scan_css_lock_10ms > 0)
+		{
+			*p++ = 'C';
+			*p++ = ' ';
+			p = NUMBER_FixedToString(p, (g_scan_css_lock_10ms < 9999) ? g_scan_css_lock_10ms : 9999, 1, 2);
+			*p++ = 's';
+		}
+		*p = 0;
+		UI_PrintStringSmall(Lock, 2, 0, 0);
+	}
+
 	// ***********************************
 	// bottom text line
 
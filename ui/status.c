@@ -23,7 +23,6 @@
 #include "bitmaps.h"
 #include "driver/keyboard.h"
 #include "driver/st7565.h"
-#include "external/printf/printf.h"
 #include "functions.h"
 #include "helper/battery.h"
 #include "misc.h"
@@ -180,6 +179,16 @@ void UI_DisplayStatus(const bool test_display)
 		if (g_charging_with_type_c)
 			x2 -= sizeof(BITMAP_USB_C);  // the radio is on USB charge
 
+		#ifdef ENABLE_FASTER_CHANNEL_SCAN
+			if (g_scan_state_dir != SCAN_OFF)
+			{	// show the scan rate in place of the battery text
+				strcpy(NUMBER_UnsignedToString(s, g_scan_channels_per_sec, 0, 0), "/s");
+				space_needed = (7 * strlen(s));
+				if (x2 >= (x1 + space_needed))
+					UI_PrintStringSmallBuffer(s, line + x2 - space_needed);
+			}
+			else
+		#endif
 		switch (g_setting_battery_text)
 		{
 			default:
@@ -189,7 +198,7 @@ void UI_DisplayStatus(const bool test_display)
 			case 1:		// voltage
 			{
 				const uint16_t voltage = (g_battery_voltage_average <= 999) ? g_battery_voltage_average : 999; // limit to 9.99V
-				sprintf(s, "%u.%02uV", voltage / 100, voltage % 100);
+				strcpy(NUMBER_FixedToString(s, voltage, 1, 2), "V");
 				space_needed = (7 * strlen(s));
 				if (x2 >= (x1 + space_needed))
 					UI_PrintStringSmallBuffer(s, line + x2 - space_needed);
@@ -198,7 +207,7 @@ void UI_DisplayStatus(const bool test_display)
 			
 			case 2:		// percentage
 			{
-				sprintf(s, "%u%%", BATTERY_VoltsToPercent(g_battery_voltage_average));
+				strcpy(NUMBER_UnsignedToString(s, BATTERY_VoltsToPercent(g_battery_voltage_average), 0, 0), "%");
 				space_needed = (7 * strlen(s));
 				if (x2 >= (x1 + space_needed))
 					UI_PrintStringSmallBuffer(s, line + x2 - space_needed);
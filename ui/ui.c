@@ -16,6 +16,9 @@
 
 #include <string.h>
 
+#ifdef ENABLE_SCAN_ACTIVITY
+	#include "app/activity.h"
+#endif
 #include "app/dtmf.h"
 #ifdef ENABLE_FMRADIO
 	#include "app/fm.h"
@@ -40,10 +43,30 @@ gui_display_type_t g_request_display_screen = DISPLAY_INVALID;
 uint8_t            g_ask_for_confirmation;
 bool               g_ask_to_save;
 bool               g_ask_to_delete;
+bool               g_gui_input_feedback;      // a key was handled, draw the next frame without waiting
+uint16_t           g_gui_frames_requested;
+uint16_t           g_gui_frames_rendered;
+
+static gui_display_type_t drawn_screen   = DISPLAY_INVALID;
+static bool               frame_pending;
+static uint8_t            frame_age_10ms = 0xff;    // since the last frame was drawn
 
 void GUI_DisplayScreen(void)
 {
-	g_update_display = false;
+	if (!frame_pending)
+		g_gui_frames_requested++;   // drawn directly rather than through GUI_TimeSlice10ms()
+	g_gui_frames_rendered++;
+
+	frame_pending        = false;
+	frame_age_10ms       = 0;
+	g_gui_input_feedback = false;
+	g_update_display     = false;
+
+	if (drawn_screen != g_screen_to_display)
+	{	// the main screen's retained widgets no longer match the frame buffer
+		drawn_screen = g_screen_to_display;
+		UI_MainInvalidate();
+	}
 
 	switch (g_screen_to_display)
 	{
@@ -76,6 +99,28 @@ void GUI_DisplayScreen(void)
 	}
 }
 
+void GUI_TimeSlice10ms(void)
+{	// every g_update_display raised since the last frame is merged into one frame,
+	// drawn no sooner than gui_frame_interval_10ms after the previous one
+	if (frame_age_10ms < 0xff)
+		frame_age_10ms++;
+
+	if (g_update_display)
+	{
+		g_update_display = false;
+		g_gui_frames_requested++;
+		frame_pending = true;
+	}
+
+	if (!frame_pending)
+		return;
+
+	if (frame_age_10ms < gui_frame_interval_10ms && !g_gui_input_feedback)
+		return;
+
+	GUI_DisplayScreen();
+}
+
 void GUI_SelectNextDisplay(gui_display_type_t Display)
 {
 	if (Display == DISPLAY_INVALID)
@@ -89,6 +134,9 @@ void GUI_SelectNextDisplay(gui_display_type_t Display)
 		g_is_in_sub_menu       = false;
 		g_css_scan_mode        = CSS_SCAN_MODE_OFF;
 		g_scan_state_dir       = SCAN_OFF;
+		#ifdef ENABLE_SCAN_ACTIVITY
+			ACTIVITY_Reset();
+		#endif
 		#ifdef ENABLE_FMRADIO
 			g_fm_scan_state    = FM_SCAN_OFF;
 		#endif
@@ -36,8 +36,12 @@ extern gui_display_type_t g_request_display_screen;
 extern uint8_t            g_ask_for_confirmation;
 extern bool               g_ask_to_save;
 extern bool               g_ask_to_delete;
+extern bool               g_gui_input_feedback;
+extern uint16_t           g_gui_frames_requested;
+extern uint16_t           g_gui_frames_rendered;
 
 void GUI_DisplayScreen(void);
+void GUI_TimeSlice10ms(void);
 void GUI_SelectNextDisplay(gui_display_type_t Display);
 
 #endif
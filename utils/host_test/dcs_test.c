@@ -0,0 +1,107 @@
+/* Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+// checks the table driven DCS_GetCdcssCode() against the original rotate and search
+// version for every 24 bit input (which covers all 2^23 23 bit words), then times both
+
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+#include "dcs.h"
+#include "misc.h"
+
+static uint8_t DCS_GetCdcssCode_Reference(uint32_t Code)
+{	// the original decoder
+	unsigned int i;
+	for (i = 0; i < 23; i++)
+	{
+		uint32_t Shift;
+
+		if (((Code >> 9) & 0x7U) == 4)
+		{
+			unsigned int j;
+			for (j = 0; j < ARRAY_SIZE(DCS_OPTIONS); j++)
+				if (DCS_OPTIONS[j] == (Code & 0x1FF))
+					if (DCS_GetGolayCodeWord(2, j) == Code)
+						return j;
+		}
+
+		Shift = Code >> 1;
+		if (Code & 1U)
+			Shift |= 0x400000U;
+		Code = Shift;
+	}
+
+	return 0xFF;
+}
+
+static double Benchmark(uint8_t (*pDecode)(uint32_t), const uint32_t Count, unsigned int *pSum)
+{	// ns per decode over a spread of inputs, about 1 in 8 of them valid codewords
+	const clock_t start = clock();
+	unsigned int  sum   = 0;
+	uint32_t      i;
+
+	for (i = 0; i < Count; i++)
+	{
+		uint32_t Code = (i * 2654435761U) & 0x7FFFFFU;
+		if ((i & 7u) == 0)
+			Code = DCS_GetGolayCodeWord(CODE_TYPE_DIGITAL, (i >> 3) % ARRAY_SIZE(DCS_OPTIONS));
+		sum += pDecode(Code);
+	}
+
+	*pSum = sum;
+	return ((double)(clock() - start) * 1e9) / ((double)CLOCKS_PER_SEC * Count);
+}
+
+int main(void)
+{
+	const uint32_t bench_count = 1u << 21;
+	unsigned int   mismatches  = 0;
+	unsigned int   found       = 0;
+	unsigned int   sum_ref;
+	unsigned int   sum_new;
+	double         ns_ref;
+	double         ns_new;
+	uint32_t       Code;
+
+	for (Code = 0; Code < (1u << 24); Code++)
+	{
+		const uint8_t expected = DCS_GetCdcssCode_Reference(Code);
+		const uint8_t result   = DCS_GetCdcssCode(Code);
+
+		if (expected != 0xFF)
+			found++;
+
+		if (result != expected)
+		{
+			if (mismatches++ < 10)
+				printf("mismatch %06X: expected %02X got %02X\n", (unsigned int)Code, expected, result);
+		}
+	}
+
+	printf("dcs: %u inputs, %u decoded, %u mismatches\n", 1u << 24, found, mismatches);
+
+	ns_ref = Benchmark(DCS_GetCdcssCode_Reference, bench_count, &sum_ref);
+	ns_new = Benchmark(DCS_GetCdcssCode,           bench_count, &sum_new);
+
+	printf("dcs: reference %.1f ns, table %.1f ns per decode (%.1fx)\n", ns_ref, ns_new, ns_ref / ns_new);
+
+	if (sum_ref != sum_new)
+		mismatches++;
+
+	return (mismatches == 0) ? 0 : 1;
+}
@@ -0,0 +1,176 @@
+/* Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+// checks the NUMBER_xxxToString() formatters against the sprintf() formats they
+// replaced in the UI, then times both
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "misc.h"
+#include "settings.h"
+
+eeprom_config_t     g_eeprom;     // misc.c reads it, settings.c isn't linked
+
+static unsigned int mismatches;
+
+static void Compare(const char *pExpected, const char *pResult, const char *pEnd, const char *pWhat)
+{
+	if (strcmp(pExpected, pResult) == 0 && pEnd == pResult + strlen(pResult))
+		return;
+
+	if (mismatches++ < 10)
+		printf("mismatch %s: expected \"%s\" got \"%s\"\n", pWhat, pExpected, pResult);
+}
+
+static uint32_t Value(const uint32_t i)
+{	// every value below 100000, then a spread over the whole range
+	return (i < 100000) ? i : i * 2654435761U;
+}
+
+static void CheckUnsigned(const uint32_t Count)
+{
+	char         expected[24];
+	char         result[24];
+	unsigned int width;
+	uint32_t     i;
+
+	for (i = 0; i < Count; i++)
+	{
+		const uint32_t v = Value(i);
+
+		for (width = 0; width <= 11; width++)
+		{
+			char *p;
+
+			sprintf(expected, "%*u", width, (unsigned int)v);
+			p = NUMBER_UnsignedToString(result, v, width, ' ');
+			Compare(expected, result, p, "%*u");
+
+			sprintf(expected, "%0*u", width, (unsigned int)v);
+			p = NUMBER_UnsignedToString(result, v, width, '0');
+			Compare(expected, result, p, "%0*u");
+		}
+	}
+}
+
+static void CheckSigned(const uint32_t Count)
+{
+	static const int32_t extremes[] = {INT32_MIN, INT32_MIN + 1, -1000000000, 999999999, INT32_MAX};
+	char         expected[24];
+	char         result[24];
+	unsigned int width;
+	uint32_t     i;
+
+	for (i = 0; i < Count + ARRAY_SIZE(extremes); i++)
+	{
+		const int32_t v = (i < Count) ? (int32_t)Value(i / 2) * ((i & 1u) ? -1 : 1) : extremes[i - Count];
+
+		for (width = 0; width <= 12; width++)
+		{
+			char *p;
+
+			sprintf(expected, "%*d", width, (int)v);
+			p = NUMBER_SignedToString(result, v, width);
+			Compare(expected, result, p, "%*d");
+		}
+	}
+}
+
+static void CheckFixed(const uint32_t Count)
+{
+	char         expected[32];
+	char         result[32];
+	unsigned int width;
+	unsigned int decimals;
+	uint32_t     i;
+
+	for (i = 0; i < Count; i++)
+	{
+		const uint32_t v     = Value(i);
+		uint32_t       scale = 1;
+
+		for (decimals = 0; decimals <= 6; decimals++, scale *= 10U)
+		{
+			for (width = 0; width <= 4; width++)
+			{
+				char *p;
+
+				if (decimals == 0)
+					sprintf(expected, "%0*u", width, (unsigned int)v);
+				else
+					sprintf(expected, "%0*u.%0*u", width, (unsigned int)(v / scale), decimals, (unsigned int)(v % scale));
+				p = NUMBER_FixedToString(result, v, width, decimals);
+				Compare(expected, result, p, "%0*u.%0*u");
+			}
+		}
+	}
+}
+
+static double Elapsed(const clock_t start, const uint32_t Count)
+{	// ns per call
+	return ((double)(clock() - start) * 1e9) / ((double)CLOCKS_PER_SEC * Count);
+}
+
+static void Benchmark(const uint32_t Count)
+{	// the typical UI calls, a frequency, a dBm reading and a channel number
+	volatile char sink;
+	char          String[24];
+	double        ns_sprintf;
+	double        ns_number;
+	clock_t       start;
+	uint32_t      i;
+
+	start = clock();
+	for (i = 0; i < Count; i++)
+	{
+		sprintf(String, "%3u.%05u", (unsigned int)(43312500 + i) / 100000, (unsigned int)(43312500 + i) % 100000);
+		sprintf(String, "%4d", (int)(i % 160) - 140);
+		sprintf(String, "CH-%03u", (unsigned int)(i % 200) + 1);
+		sink = String[0];
+	}
+	ns_sprintf = Elapsed(start, Count);
+
+	start = clock();
+	for (i = 0; i < Count; i++)
+	{
+		NUMBER_FixedToString(String, 43312500 + i, 3, 5);
+		NUMBER_SignedToString(String, (int32_t)(i % 160) - 140, 4);
+		strcpy(String, "CH-");
+		NUMBER_UnsignedToString(String + 3, (i % 200) + 1, 3, '0');
+		sink = String[0];
+	}
+	ns_number = Elapsed(start, Count);
+
+	(void)sink;
+
+	printf("number: sprintf %.1f ns, NUMBER_xxxToString %.1f ns per set of 3 (%.1fx)\n", ns_sprintf, ns_number, ns_sprintf / ns_number);
+}
+
+int main(void)
+{
+	CheckUnsigned(1000000);
+	CheckSigned(1000000);
+	CheckFixed(300000);
+
+	printf("number: %u mismatches\n", mismatches);
+
+	Benchmark(2000000);
+
+	return (mismatches == 0) ? 0 : 1;
+}